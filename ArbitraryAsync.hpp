@@ -0,0 +1,107 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <ArbitraryMontgomery.hpp>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace ArbitraryPrecision {
+
+// Runs a task away from the calling thread, e.g. by posting it to a pool
+using Executor = std::function<void(std::function<void()>)>;
+
+// Default executor: one detached std::thread per task
+inline Executor thread_executor() {
+  return [](std::function<void()> task) {
+    std::thread(std::move(task)).detach();
+  };
+}
+
+// Awaitable result of a computation handed to an executor. The awaiting
+// coroutine suspends until the work finishes and then resumes on the thread
+// that ran it; await_resume() returns the result or rethrows, including
+// OperationCancelled once `stop` is requested.
+//
+//   std::stop_source stop;
+//   std::string digits = co_await co_to_string(value, stop.get_token());
+template <typename Result> class Computation {
+public:
+  Computation(std::function<Result()> work, std::stop_token stop,
+              Executor executor)
+      : work(std::move(work)), stop(std::move(stop)),
+        executor(std::move(executor)) {}
+
+  Computation(const Computation &) = delete;
+  Computation &operator=(const Computation &) = delete;
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    // The task may resume the caller, and so destroy this awaiter, before
+    // the executor call returns; keep the executor alive on this stack
+    const Executor run = std::move(executor);
+    run([this, handle] {
+      try {
+        StopScope scope(stop);
+        cancellation_point();
+        result.emplace(work());
+      } catch (...) {
+        error = std::current_exception();
+      }
+      handle.resume();
+    });
+  }
+
+  Result await_resume() {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return std::move(*result);
+  }
+
+private:
+  std::function<Result()> work;
+  std::stop_token stop;
+  Executor executor;
+  std::optional<Result> result;
+  std::exception_ptr error;
+};
+
+// a * b off the awaiting thread. Operands are copied into the task.
+template <Integer T>
+Computation<T> co_multiply(T a, T b, std::stop_token stop = {},
+                           Executor executor = thread_executor()) {
+  return Computation<T>(
+      [a = std::move(a), b = std::move(b)] { return a * b; }, std::move(stop),
+      std::move(executor));
+}
+
+// to_string(value) off the awaiting thread
+template <Integer T>
+Computation<std::string> co_to_string(T value, std::stop_token stop = {},
+                                      Executor executor = thread_executor()) {
+  return Computation<std::string>(
+      [value = std::move(value)] { return to_string(value); }, std::move(stop),
+      std::move(executor));
+}
+
+// powmod(base, exponent, modulus) off the awaiting thread; cancellation is
+// checked once per exponent window
+template <size_t Bits, Integer E>
+Computation<FixedInteger<Bits>>
+co_powmod(FixedInteger<Bits> base, E exponent, FixedInteger<Bits> modulus,
+          std::stop_token stop = {}, Executor executor = thread_executor()) {
+  return Computation<FixedInteger<Bits>>(
+      [base, exponent = std::move(exponent), modulus] {
+        return powmod(base, exponent, modulus);
+      },
+      std::move(stop), std::move(executor));
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <ArbitraryFloat.hpp>
+#include <ArbitrarySeries.hpp>
+#include <cmath>
+#include <thread>
+
+namespace ArbitraryPrecision {
+
+// Mathematical constants by binary splitting, correctly rounded to within
+// the guard bits. `threads` is passed on to parallel_binary_split.
+namespace constants {
+
+// Chudnovsky series:
+//   1/pi = 12 / 640320^(3/2) * sum (-1)^k (6k)! (13591409 + 545140134 k)
+//                                  / ((3k)! (k!)^3 640320^(3k))
+// about 47.11 bits per term
+inline BigFloat pi(size_t precision,
+                   size_t threads = std::thread::hardware_concurrency()) {
+  const size_t working = precision + detail::float_guard_bits;
+  const auto terms = static_cast<size_t>(static_cast<double>(working) /
+                                         47.11047586) +
+                     2;
+  // 640320^3 / 24
+  const DynamicInteger c3_24(10939058860032000ULL);
+
+  auto split = parallel_binary_split(
+      [&](size_t k) {
+        if (k == 0) {
+          return SeriesTerm{DynamicInteger(13591409)};
+        }
+        const DynamicInteger n(k);
+        return SeriesTerm{
+            DynamicInteger(13591409) + DynamicInteger(545140134) * n,
+            DynamicInteger(1),
+            DynamicInteger(6 * k - 5) * DynamicInteger(2 * k - 1) *
+                DynamicInteger(6 * k - 1),
+            n * n * n * c3_24, true};
+      },
+      0, terms, threads);
+
+  // pi = 426880 sqrt(10005) q / t
+  const BigFloat root = sqrt(BigFloat(10005, working), working);
+  const BigFloat numerator = BigFloat::multiply(
+      root, BigFloat(split.q * DynamicInteger(426880), working), working);
+  return BigFloat::divide(numerator, BigFloat(split.t, working), precision);
+}
+
+// e = sum 1 / k!
+inline BigFloat e(size_t precision,
+                  size_t threads = std::thread::hardware_concurrency()) {
+  const size_t working = precision + detail::float_guard_bits;
+  size_t terms = 1;
+  for (double log2_factorial = 0; log2_factorial < double(working + 4);
+       ++terms) {
+    log2_factorial += std::log2(static_cast<double>(terms));
+  }
+
+  auto split = parallel_binary_split(
+      [](size_t k) {
+        return SeriesTerm{DynamicInteger(1), DynamicInteger(1),
+                          DynamicInteger(1), DynamicInteger(k ? k : 1)};
+      },
+      0, terms, threads);
+  return detail::series_value(split, working).round(precision);
+}
+
+// ln 2 = 2 atanh(1/3) = sum 2 / ((2k + 1) 3^(2k + 1))
+inline BigFloat ln2(size_t precision,
+                    size_t threads = std::thread::hardware_concurrency()) {
+  const size_t working = precision + detail::float_guard_bits;
+  const auto terms =
+      static_cast<size_t>(static_cast<double>(working + 4) / std::log2(9.0)) +
+      2;
+
+  auto split = parallel_binary_split(
+      [](size_t k) {
+        return SeriesTerm{DynamicInteger(2), DynamicInteger(2 * k + 1),
+                          DynamicInteger(1), DynamicInteger(k ? 9 : 3)};
+      },
+      0, terms, threads);
+  return detail::series_value(split, working).round(precision);
+}
+
+} // namespace constants
+} // namespace ArbitraryPrecision
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+// (hi * 2^64 + lo) mod m, requires hi < m
+constexpr uint64_t mod_wide(uint64_t hi, uint64_t lo, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+  if !consteval {
+    return static_cast<uint64_t>(((static_cast<uint128>(hi) << 64) | lo) % m);
+  }
+#endif
+  uint64_t r = hi;
+  for (size_t bit = 64; bit > 0; --bit) {
+    bool carry = r >> 63;
+    r = (r << 1) | ((lo >> (bit - 1)) & 1);
+    if (carry || r >= m)
+      r -= m;
+  }
+  return r;
+}
+
+// a * b mod m for any 64-bit modulus
+constexpr uint64_t mulmod_u64(uint64_t a, uint64_t b, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+  if !consteval {
+    return static_cast<uint64_t>(static_cast<uint128>(a) * b % m);
+  }
+#endif
+  uint64_t result = 0;
+  a %= m;
+  for (; b; b >>= 1) {
+    if (b & 1)
+      result = (result >= m - a) ? result - (m - a) : result + a;
+    a = (a >= m - a) ? a - (m - a) : a + a;
+  }
+  return result;
+}
+
+// Inverse of a modulo m by the extended Euclidean algorithm
+constexpr uint64_t inverse_u64(uint64_t a, uint64_t m) {
+  uint64_t r0 = m, r1 = a % m;
+  uint64_t t0 = 0, t1 = 1; // coefficients of a, kept modulo m
+  while (r1) {
+    uint64_t q = r0 / r1;
+    uint64_t r2 = r0 - q * r1;
+    uint64_t qt = mulmod_u64(q % m, t1, m);
+    uint64_t t2 = t0 >= qt ? t0 - qt : t0 + (m - qt);
+    r0 = r1;
+    r1 = r2;
+    t0 = t1;
+    t1 = t2;
+  }
+  if (r0 != 1) {
+    throw std::domain_error("Moduli must be pairwise coprime");
+  }
+  return t0;
+}
+
+// value mod m, one limb at a time
+inline uint64_t mod_u64(const DynamicInteger &value, uint64_t m) {
+  uint64_t r = 0;
+  auto limbs = value.as_span();
+  for (size_t i = limbs.size(); i > 0; --i) {
+    r = mod_wide(r, limbs[i - 1], m);
+  }
+  return r;
+}
+} // namespace detail
+
+// Subproduct tree over a set of 64-bit moduli. Reducing one integer modulo
+// all of them (a remainder tree) and CRT reconstruction (a linear
+// combination up the tree) both cost a few big divisions/multiplications per
+// level instead of one per modulus. The moduli are grouped into leaves that
+// are handled with single-limb arithmetic.
+class SubproductTree {
+public:
+  static constexpr size_t leaf_size = 8;
+
+  explicit SubproductTree(std::span<const uint64_t> moduli)
+      : moduli_(moduli.begin(), moduli.end()) {
+    if (moduli_.empty()) {
+      throw std::domain_error("Empty moduli set");
+    }
+    for (uint64_t m : moduli_) {
+      if (m < 2) {
+        throw std::domain_error("Moduli must be at least 2");
+      }
+    }
+
+    std::vector<DynamicInteger> leaves;
+    for (size_t begin = 0; begin < moduli_.size(); begin += leaf_size) {
+      DynamicInteger product(1);
+      for (size_t i = begin; i < leaf_end(begin); ++i) {
+        product *= DynamicInteger(moduli_[i]);
+      }
+      leaves.push_back(std::move(product));
+    }
+    levels.push_back(std::move(leaves));
+    while (levels.back().size() > 1) {
+      const auto &below = levels.back();
+      std::vector<DynamicInteger> above;
+      for (size_t i = 0; i < below.size(); i += 2) {
+        above.push_back(i + 1 < below.size() ? below[i] * below[i + 1]
+                                             : below[i]);
+      }
+      levels.push_back(std::move(above));
+    }
+  }
+
+  std::span<const uint64_t> moduli() const { return moduli_; }
+
+  const DynamicInteger &product() const { return levels.back()[0]; }
+
+  // value mod m_i for every modulus
+  std::vector<uint64_t> reduce(const DynamicInteger &value) const {
+    std::vector<DynamicInteger> remainders{value % product()};
+    for (size_t level = levels.size() - 1; level > 0; --level) {
+      remainders = descend(remainders, level, [](const DynamicInteger &parent,
+                                                 const DynamicInteger &,
+                                                 const DynamicInteger &child) {
+        return parent % child;
+      });
+    }
+
+    std::vector<uint64_t> residues(moduli_.size());
+    for (size_t leaf = 0; leaf < remainders.size(); ++leaf) {
+      const size_t begin = leaf * leaf_size;
+      for (size_t i = begin; i < leaf_end(begin); ++i) {
+        residues[i] = detail::mod_u64(remainders[leaf], moduli_[i]);
+      }
+    }
+    return residues;
+  }
+
+  // The unique x < product() with x = residues[i] (mod m_i)
+  DynamicInteger reconstruct(std::span<const uint64_t> residues) const {
+    if (residues.size() != moduli_.size()) {
+      throw std::domain_error("Residue count does not match moduli");
+    }
+    std::call_once(inverses_ready, [this] { compute_inverses(); });
+
+    // Leaves: sum over the group of t_i * (G / m_i), t_i = r_i * s_i mod m_i
+    std::vector<DynamicInteger> sums;
+    for (size_t begin = 0; begin < moduli_.size(); begin += leaf_size) {
+      DynamicInteger sum;
+      for (size_t i = begin; i < leaf_end(begin); ++i) {
+        DynamicInteger term(detail::mulmod_u64(residues[i] % moduli_[i],
+                                               inverses[i], moduli_[i]));
+        for (size_t j = begin; j < leaf_end(begin); ++j) {
+          if (j != i)
+            term *= DynamicInteger(moduli_[j]);
+        }
+        sum += term;
+      }
+      sums.push_back(std::move(sum));
+    }
+
+    // Parents: S = S_left * P_right + S_right * P_left
+    for (size_t level = 0; level + 1 < levels.size(); ++level) {
+      const auto &products = levels[level];
+      std::vector<DynamicInteger> above;
+      for (size_t i = 0; i < sums.size(); i += 2) {
+        above.push_back(i + 1 < sums.size()
+                            ? sums[i] * products[i + 1] +
+                                  sums[i + 1] * products[i]
+                            : sums[i]);
+      }
+      sums = std::move(above);
+    }
+
+    return sums[0] % product();
+  }
+
+private:
+  std::vector<uint64_t> moduli_;
+  // levels[0] holds the leaf-group products, levels.back() the root
+  std::vector<std::vector<DynamicInteger>> levels;
+  // s_i = (M / m_i)^-1 mod m_i, computed on first reconstruction since
+  // reduction does not need coprime moduli
+  mutable std::once_flag inverses_ready;
+  mutable std::vector<uint64_t> inverses;
+
+  size_t leaf_end(size_t begin) const {
+    return std::min(begin + leaf_size, moduli_.size());
+  }
+
+  // Maps each node's value at `level` onto its children at `level - 1`
+  template <typename Step>
+  std::vector<DynamicInteger> descend(const std::vector<DynamicInteger> &values,
+                                      size_t level, Step step) const {
+    const auto &children = levels[level - 1];
+    std::vector<DynamicInteger> result;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const size_t left = 2 * i;
+      if (left + 1 < children.size()) {
+        result.push_back(step(values[i], children[left + 1], children[left]));
+        result.push_back(step(values[i], children[left], children[left + 1]));
+      } else {
+        result.push_back(values[i] % children[left]);
+      }
+    }
+    return result;
+  }
+
+  // Walks (M / node) mod node down the tree: a child C with sibling D gets
+  // (parent_value * D) mod C. At the leaves this yields M / m_i mod m_i.
+  void compute_inverses() const {
+    std::vector<DynamicInteger> cofactors{DynamicInteger(1) % product()};
+    for (size_t level = levels.size() - 1; level > 0; --level) {
+      cofactors = descend(cofactors, level, [](const DynamicInteger &parent,
+                                               const DynamicInteger &sibling,
+                                               const DynamicInteger &child) {
+        return parent * sibling % child;
+      });
+    }
+
+    std::vector<uint64_t> result(moduli_.size());
+    for (size_t leaf = 0; leaf < cofactors.size(); ++leaf) {
+      const size_t begin = leaf * leaf_size;
+      for (size_t i = begin; i < leaf_end(begin); ++i) {
+        const uint64_t m = moduli_[i];
+        uint64_t cofactor = detail::mod_u64(cofactors[leaf], m);
+        for (size_t j = begin; j < leaf_end(begin); ++j) {
+          if (j != i)
+            cofactor = detail::mulmod_u64(cofactor, moduli_[j] % m, m);
+        }
+        result[i] = detail::inverse_u64(cofactor, m);
+      }
+    }
+    inverses = std::move(result);
+  }
+};
+
+namespace detail {
+// Trees for the most recently used moduli sets on this thread
+inline std::shared_ptr<const SubproductTree>
+cached_subproduct_tree(std::span<const uint64_t> moduli) {
+  constexpr size_t capacity = 4;
+  thread_local std::vector<std::shared_ptr<const SubproductTree>> cache;
+
+  auto it = std::find_if(cache.begin(), cache.end(), [&](const auto &tree) {
+    return std::ranges::equal(tree->moduli(), moduli);
+  });
+  if (it != cache.end()) {
+    std::rotate(cache.begin(), it, it + 1);
+    return cache.front();
+  }
+
+  auto tree = std::make_shared<const SubproductTree>(moduli);
+  if (cache.size() == capacity) {
+    cache.pop_back();
+  }
+  cache.insert(cache.begin(), tree);
+  return tree;
+}
+} // namespace detail
+
+// CRT reconstruction: the unique x below the product of the (pairwise
+// coprime) moduli with x = residues[i] mod moduli[i]
+inline DynamicInteger crt(std::span<const uint64_t> residues,
+                          std::span<const uint64_t> moduli) {
+  return detail::cached_subproduct_tree(moduli)->reconstruct(residues);
+}
+
+// value mod moduli[i] for every modulus, via a remainder tree
+inline std::vector<uint64_t> multi_mod(const DynamicInteger &value,
+                                       std::span<const uint64_t> moduli) {
+  return detail::cached_subproduct_tree(moduli)->reduce(value);
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,575 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+using Limbs512 = std::array<uint64_t, 8>;
+
+// 64 hex digits, most significant first
+consteval FixedInteger<256> hex256(std::string_view digits) {
+  if (digits.size() != 64) {
+    throw std::domain_error("Expected 64 hex digits");
+  }
+  FixedInteger<256> result;
+  auto limbs = result.as_span();
+  for (size_t i = 0; i < 64; ++i) {
+    const char c = digits[63 - i];
+    const uint64_t nibble = c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+    limbs[i / 16] |= nibble << (4 * (i % 16));
+  }
+  return result;
+}
+
+// Full 512-bit product of two 256-bit values
+inline Limbs512 multiply_wide(const FixedInteger<256> &a,
+                              const FixedInteger<256> &b) {
+  Limbs512 result{};
+  auto x = a.as_span();
+  auto y = b.as_span();
+  for (size_t i = 0; i < 4; ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < 4; ++j) {
+      std::tie(result[i + j], carry) =
+          mul_add(x[i], y[j], result[i + j], carry);
+    }
+    result[i + 4] = carry;
+  }
+  return result;
+}
+
+// Reduction modulo p = 2^256 - c (or a prime dividing it, like 2^255 - 19
+// with c = 38): the high half folds in as hi * c, twice, then at most a few
+// subtractions of p
+inline FixedInteger<256> reduce_pseudo_mersenne(const Limbs512 &product,
+                                                uint64_t c,
+                                                const FixedInteger<256> &p) {
+  FixedInteger<256> result;
+  auto r = result.as_span();
+  uint64_t carry = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    std::tie(r[i], carry) = mul_add(product[i + 4], c, product[i], carry);
+  }
+
+  // carry * c spans two limbs; `add` ends nonzero if the sum wraps
+  auto [add, next] = mul_add(carry, c, 0, 0);
+  for (size_t i = 0; i < 4 && (add || next); ++i) {
+    r[i] += add;
+    add = next + (r[i] < add);
+    next = 0;
+  }
+  // A final wrap leaves a small value, so adding c again cannot carry
+  if (add) {
+    result += FixedInteger<256>(c);
+  }
+
+  while (result >= p) {
+    result -= p;
+  }
+  return result;
+}
+} // namespace detail
+
+// Prime fields of the supported curves: the modulus and a reduction of a
+// full 512-bit product
+struct Secp256k1Field {
+  static constexpr FixedInteger<256> modulus = detail::hex256(
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+
+  static FixedInteger<256> reduce(const detail::Limbs512 &product) {
+    return detail::reduce_pseudo_mersenne(product, 0x1000003D1, modulus);
+  }
+};
+
+struct P256Field {
+  static constexpr FixedInteger<256> modulus = detail::hex256(
+      "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF");
+
+  // Solinas reduction (FIPS 186-4 D.2.3): a signed sum of 32-bit words of
+  // the product, then a handful of additions or subtractions of p
+  static FixedInteger<256> reduce(const detail::Limbs512 &product) {
+    std::array<int64_t, 16> c;
+    for (size_t i = 0; i < 16; ++i) {
+      c[i] = static_cast<int64_t>((product[i / 2] >> (32 * (i % 2))) &
+                                  0xFFFFFFFF);
+    }
+    const std::array<int64_t, 8> columns = {
+        c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14],
+        c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15],
+        c[2] + c[10] + c[11] - c[13] - c[14] - c[15],
+        c[3] + 2 * c[11] + 2 * c[12] + c[13] - c[15] - c[8] - c[9],
+        c[4] + 2 * c[12] + 2 * c[13] + c[14] - c[9] - c[10],
+        c[5] + 2 * c[13] + 2 * c[14] + c[15] - c[10] - c[11],
+        c[6] + 3 * c[14] + 2 * c[15] + c[13] - c[8] - c[9],
+        c[7] + 3 * c[15] + c[8] - c[10] - c[11] - c[12] - c[13],
+    };
+
+    FixedInteger<256> result;
+    auto r = result.as_span();
+    int64_t carry = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      const int64_t v = columns[i] + carry;
+      r[i / 2] |= static_cast<uint64_t>(v & 0xFFFFFFFF) << (32 * (i % 2));
+      carry = v >> 32;
+    }
+
+    // The value is result + carry * 2^256 with a small signed carry
+    while (carry < 0) {
+      result += modulus;
+      carry += result < modulus;
+    }
+    while (carry > 0) {
+      carry -= result < modulus;
+      result -= modulus;
+    }
+    while (result >= modulus) {
+      result -= modulus;
+    }
+    return result;
+  }
+};
+
+struct Curve25519Field {
+  static constexpr FixedInteger<256> modulus = detail::hex256(
+      "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED");
+
+  // 2^256 = 38 (mod 2^255 - 19)
+  static FixedInteger<256> reduce(const detail::Limbs512 &product) {
+    return detail::reduce_pseudo_mersenne(product, 38, modulus);
+  }
+};
+
+template <typename F>
+concept CurveField = requires(const detail::Limbs512 &product) {
+  { F::modulus } -> std::convertible_to<FixedInteger<256>>;
+  { F::reduce(product) } -> std::same_as<FixedInteger<256>>;
+};
+
+// Element of a curve's prime field, always fully reduced
+template <CurveField F> class FieldElement {
+public:
+  using Value = FixedInteger<256>;
+
+  FieldElement() = default;
+
+  explicit FieldElement(const Value &value)
+      : value_(value >= F::modulus ? value % F::modulus : value) {}
+
+  explicit FieldElement(uint64_t value) : value_(value) {}
+
+  const Value &value() const { return value_; }
+
+  explicit operator bool() const { return static_cast<bool>(value_); }
+
+  FieldElement operator-() const {
+    FieldElement result;
+    if (value_) {
+      result.value_ = F::modulus - value_;
+    }
+    return result;
+  }
+
+  FieldElement &operator+=(const FieldElement &other) {
+    const Value sum = value_ + other.value_;
+    value_ = (sum < value_ || sum >= F::modulus) ? sum - F::modulus : sum;
+    return *this;
+  }
+
+  FieldElement &operator-=(const FieldElement &other) {
+    value_ = value_ >= other.value_ ? value_ - other.value_
+                                    : value_ - other.value_ + F::modulus;
+    return *this;
+  }
+
+  FieldElement &operator*=(const FieldElement &other) {
+    value_ = F::reduce(detail::multiply_wide(value_, other.value_));
+    return *this;
+  }
+
+  FieldElement operator+(const FieldElement &other) const {
+    FieldElement result = *this;
+    return result += other;
+  }
+
+  FieldElement operator-(const FieldElement &other) const {
+    FieldElement result = *this;
+    return result -= other;
+  }
+
+  FieldElement operator*(const FieldElement &other) const {
+    FieldElement result = *this;
+    return result *= other;
+  }
+
+  FieldElement square() const { return *this * *this; }
+
+  FieldElement doubled() const { return *this + *this; }
+
+  bool operator==(const FieldElement &other) const = default;
+
+  FieldElement pow(const Value &exponent) const {
+    FieldElement result(1);
+    for (size_t bit = bit_width(exponent); bit > 0; --bit) {
+      result = result.square();
+      if ((exponent.as_span()[(bit - 1) / 64] >> ((bit - 1) % 64)) & 1) {
+        result *= *this;
+      }
+    }
+    return result;
+  }
+
+  // this^(p - 2)
+  FieldElement inverse() const {
+    if (!value_) {
+      throw std::domain_error("Division by zero");
+    }
+    return pow(F::modulus - Value(2));
+  }
+
+private:
+  Value value_;
+};
+
+// Short Weierstrass curves y^2 = x^3 + a x + b with a = 0 or a = -3
+struct Secp256k1 {
+  using Field = FieldElement<Secp256k1Field>;
+  static constexpr bool a_is_zero = true;
+  static constexpr FixedInteger<256> b{7};
+  static constexpr FixedInteger<256> gx = detail::hex256(
+      "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798");
+  static constexpr FixedInteger<256> gy = detail::hex256(
+      "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8");
+  static constexpr FixedInteger<256> order = detail::hex256(
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141");
+};
+
+struct P256 {
+  using Field = FieldElement<P256Field>;
+  static constexpr bool a_is_zero = false;
+  static constexpr FixedInteger<256> b = detail::hex256(
+      "5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B");
+  static constexpr FixedInteger<256> gx = detail::hex256(
+      "6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296");
+  static constexpr FixedInteger<256> gy = detail::hex256(
+      "4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5");
+  static constexpr FixedInteger<256> order = detail::hex256(
+      "FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551");
+};
+
+// edwards25519, the twisted Edwards form -x^2 + y^2 = 1 + d x^2 y^2 of
+// Curve25519 used by Ed25519
+struct Ed25519 {
+  using Field = FieldElement<Curve25519Field>;
+  static constexpr FixedInteger<256> d = detail::hex256(
+      "52036CEE2B6FFE738CC740797779E89800700A4D4141D8AB75EB4DCA135978A3");
+  static constexpr FixedInteger<256> gx = detail::hex256(
+      "216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51A");
+  static constexpr FixedInteger<256> gy = detail::hex256(
+      "6666666666666666666666666666666666666666666666666666666666666658");
+  static constexpr FixedInteger<256> order = detail::hex256(
+      "1000000000000000000000000000000014DEF9DEA2F79CD65812631A5CF5D3ED");
+};
+
+// Point in Jacobian coordinates (X : Y : Z), affine (X / Z^2, Y / Z^3);
+// Z = 0 is the point at infinity
+template <typename Curve> class JacobianPoint {
+public:
+  using Field = typename Curve::Field;
+
+  // The point at infinity
+  JacobianPoint() : x_(1), y_(1), z_(0) {}
+
+  static JacobianPoint identity() { return JacobianPoint(); }
+
+  static JacobianPoint generator() {
+    return JacobianPoint(Field(Curve::gx), Field(Curve::gy), Field(1));
+  }
+
+  static JacobianPoint from_affine(const Field &x, const Field &y) {
+    Field rhs = x.square() * x + Field(Curve::b);
+    if constexpr (!Curve::a_is_zero) {
+      rhs -= x.doubled() + x;
+    }
+    if (y.square() != rhs) {
+      throw std::domain_error("Point is not on the curve");
+    }
+    return JacobianPoint(x, y, Field(1));
+  }
+
+  bool is_identity() const { return !z_; }
+
+  std::pair<Field, Field> to_affine() const {
+    if (is_identity()) {
+      throw std::domain_error("Point at infinity has no affine form");
+    }
+    const Field z_inverse = z_.inverse();
+    const Field z2 = z_inverse.square();
+    return {x_ * z2, y_ * z2 * z_inverse};
+  }
+
+  JacobianPoint operator-() const { return JacobianPoint(x_, -y_, z_); }
+
+  JacobianPoint doubled() const {
+    if (is_identity() || !y_) {
+      return identity();
+    }
+    if constexpr (Curve::a_is_zero) {
+      // dbl-2009-l
+      const Field a = x_.square();
+      const Field b = y_.square();
+      const Field c = b.square();
+      const Field d = ((x_ + b).square() - a - c).doubled();
+      const Field e = a.doubled() + a;
+      const Field x3 = e.square() - d.doubled();
+      return JacobianPoint(x3, e * (d - x3) - c.doubled().doubled().doubled(),
+                           (y_ * z_).doubled());
+    } else {
+      // dbl-2001-b
+      const Field delta = z_.square();
+      const Field gamma = y_.square();
+      const Field beta = x_ * gamma;
+      const Field t = (x_ - delta) * (x_ + delta);
+      const Field alpha = t.doubled() + t;
+      const Field beta4 = beta.doubled().doubled();
+      const Field x3 = alpha.square() - beta4.doubled();
+      const Field gamma8 = gamma.square().doubled().doubled().doubled();
+      return JacobianPoint(x3, alpha * (beta4 - x3) - gamma8,
+                           (y_ + z_).square() - gamma - delta);
+    }
+  }
+
+  // add-2007-bl, falling back to doubling for equal inputs
+  JacobianPoint operator+(const JacobianPoint &other) const {
+    if (is_identity()) {
+      return other;
+    }
+    if (other.is_identity()) {
+      return *this;
+    }
+    const Field z1z1 = z_.square();
+    const Field z2z2 = other.z_.square();
+    const Field u1 = x_ * z2z2;
+    const Field u2 = other.x_ * z1z1;
+    const Field s1 = y_ * other.z_ * z2z2;
+    const Field s2 = other.y_ * z_ * z1z1;
+    const Field h = u2 - u1;
+    const Field r = (s2 - s1).doubled();
+    if (!h) {
+      return r ? identity() : doubled();
+    }
+    const Field i = h.doubled().square();
+    const Field j = h * i;
+    const Field v = u1 * i;
+    const Field x3 = r.square() - j - v.doubled();
+    return JacobianPoint(x3, r * (v - x3) - (s1 * j).doubled(),
+                         ((z_ + other.z_).square() - z1z1 - z2z2) * h);
+  }
+
+  JacobianPoint &operator+=(const JacobianPoint &other) {
+    return *this = *this + other;
+  }
+
+  bool operator==(const JacobianPoint &other) const {
+    if (is_identity() || other.is_identity()) {
+      return is_identity() == other.is_identity();
+    }
+    const Field z1z1 = z_.square();
+    const Field z2z2 = other.z_.square();
+    return x_ * z2z2 == other.x_ * z1z1 &&
+           y_ * z2z2 * other.z_ == other.y_ * z1z1 * z_;
+  }
+
+private:
+  Field x_, y_, z_;
+
+  JacobianPoint(const Field &x, const Field &y, const Field &z)
+      : x_(x), y_(y), z_(z) {}
+};
+
+// Point on a twisted Edwards curve with a = -1 in extended coordinates
+// (X : Y : Z : T), affine (X / Z, Y / Z) and T = XY / Z. The addition law
+// is complete, so no input needs special handling.
+template <typename Curve> class ExtendedPoint {
+public:
+  using Field = typename Curve::Field;
+
+  // The neutral element (0, 1)
+  ExtendedPoint() : x_(0), y_(1), z_(1), t_(0) {}
+
+  static ExtendedPoint identity() { return ExtendedPoint(); }
+
+  static ExtendedPoint generator() {
+    return from_affine(Field(Curve::gx), Field(Curve::gy));
+  }
+
+  static ExtendedPoint from_affine(const Field &x, const Field &y) {
+    const Field x2 = x.square();
+    const Field y2 = y.square();
+    if (y2 - x2 != Field(1) + Field(Curve::d) * x2 * y2) {
+      throw std::domain_error("Point is not on the curve");
+    }
+    return ExtendedPoint(x, y, Field(1), x * y);
+  }
+
+  bool is_identity() const { return !x_ && y_ == z_; }
+
+  std::pair<Field, Field> to_affine() const {
+    const Field z_inverse = z_.inverse();
+    return {x_ * z_inverse, y_ * z_inverse};
+  }
+
+  ExtendedPoint operator-() const { return ExtendedPoint(-x_, y_, z_, -t_); }
+
+  // dbl-2008-hwcd
+  ExtendedPoint doubled() const {
+    const Field a = x_.square();
+    const Field b = y_.square();
+    const Field c = z_.square().doubled();
+    const Field e = (x_ + y_).square() - a - b;
+    const Field g = b - a;
+    const Field f = g - c;
+    const Field h = -a - b;
+    return ExtendedPoint(e * f, g * h, f * g, e * h);
+  }
+
+  // add-2008-hwcd-3
+  ExtendedPoint operator+(const ExtendedPoint &other) const {
+    static const Field k = Field(Curve::d).doubled();
+    const Field a = (y_ - x_) * (other.y_ - other.x_);
+    const Field b = (y_ + x_) * (other.y_ + other.x_);
+    const Field c = t_ * k * other.t_;
+    const Field d = (z_ * other.z_).doubled();
+    const Field e = b - a;
+    const Field f = d - c;
+    const Field g = d + c;
+    const Field h = b + a;
+    return ExtendedPoint(e * f, g * h, f * g, e * h);
+  }
+
+  ExtendedPoint &operator+=(const ExtendedPoint &other) {
+    return *this = *this + other;
+  }
+
+  bool operator==(const ExtendedPoint &other) const {
+    return x_ * other.z_ == other.x_ * z_ && y_ * other.z_ == other.y_ * z_;
+  }
+
+private:
+  Field x_, y_, z_, t_;
+
+  ExtendedPoint(const Field &x, const Field &y, const Field &z, const Field &t)
+      : x_(x), y_(y), z_(z), t_(t) {}
+};
+
+template <typename P>
+concept CurvePoint = requires(const P &a, const P &b) {
+  { P::identity() } -> std::same_as<P>;
+  { a + b } -> std::same_as<P>;
+  { a.doubled() } -> std::same_as<P>;
+  { a.is_identity() } -> std::same_as<bool>;
+};
+
+namespace detail {
+// Window size of the fixed-window scalar multiplication
+inline constexpr size_t scalar_window_bits = 4;
+
+// Bits [offset, offset + width) of a scalar, width <= 64
+inline size_t scalar_window(const FixedInteger<256> &scalar, size_t offset,
+                            size_t width) {
+  auto limbs = scalar.as_span();
+  if (offset >= 256) {
+    return 0;
+  }
+  uint64_t bits = limbs[offset / 64] >> (offset % 64);
+  if (offset % 64 + width > 64 && offset / 64 + 1 < 4) {
+    bits |= limbs[offset / 64 + 1] << (64 - offset % 64);
+  }
+  return static_cast<size_t>(bits & ((uint64_t(1) << width) - 1));
+}
+} // namespace detail
+
+// scalar * point with a fixed 4-bit window: 15 precomputed multiples, then
+// four doublings and at most one addition per window
+template <CurvePoint P>
+P scalar_multiply(const P &point, const FixedInteger<256> &scalar) {
+  constexpr size_t w = detail::scalar_window_bits;
+  std::array<P, (size_t(1) << w)> table;
+  table[1] = point;
+  for (size_t i = 2; i < table.size(); ++i) {
+    table[i] = i % 2 ? table[i - 1] + point : table[i / 2].doubled();
+  }
+
+  P result;
+  for (size_t window = (bit_width(scalar) + w - 1) / w; window > 0; --window) {
+    for (size_t i = 0; i < w; ++i) {
+      result = result.doubled();
+    }
+    if (size_t digit = detail::scalar_window(scalar, (window - 1) * w, w)) {
+      result += table[digit];
+    }
+  }
+  return result;
+}
+
+// sum scalars[i] * points[i] by Pippenger's bucket method: per c-bit window,
+// each point is added to the bucket of its digit once, and the buckets are
+// combined with two running sums instead of per-point multiplications
+template <CurvePoint P>
+P multi_scalar_multiply(std::span<const P> points,
+                        std::span<const FixedInteger<256>> scalars) {
+  if (points.size() != scalars.size()) {
+    throw std::domain_error("Point and scalar counts differ");
+  }
+  if (points.empty()) {
+    return P::identity();
+  }
+  if (points.size() == 1) {
+    return scalar_multiply(points[0], scalars[0]);
+  }
+
+  const size_t c =
+      points.size() < 32
+          ? 3
+          : std::min<size_t>(std::bit_width(points.size()) - 2, 16);
+  size_t bits = 0;
+  for (const auto &scalar : scalars) {
+    bits = std::max(bits, bit_width(scalar));
+  }
+
+  P result;
+  std::vector<P> buckets((size_t(1) << c) - 1);
+  for (size_t window = (bits + c - 1) / c; window > 0; --window) {
+    for (size_t i = 0; i < c; ++i) {
+      result = result.doubled();
+    }
+    std::fill(buckets.begin(), buckets.end(), P::identity());
+    for (size_t i = 0; i < points.size(); ++i) {
+      const size_t digit =
+          detail::scalar_window(scalars[i], (window - 1) * c, c);
+      if (digit) {
+        buckets[digit - 1] += points[i];
+      }
+    }
+    // sum_d d * bucket[d] as a running suffix sum
+    P running, sum;
+    for (size_t d = buckets.size(); d > 0; --d) {
+      running += buckets[d - 1];
+      sum += running;
+    }
+    result += sum;
+  }
+  return result;
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <compare>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ArbitraryPrecision {
+
+// Signed fixed-point decimal: a two's-complement FixedInteger<Bits> holding
+// value * 10^Scale. Addition and subtraction are plain integer operations;
+// multiplication forms the double-width product and rescales by 10^Scale
+// with a compile-time reciprocal instead of the bit-serial divider. Results
+// are truncated toward zero and wrap like FixedInteger on overflow.
+template <size_t Bits, size_t Scale>
+  requires(Scale * 10 / 3 + 2 < Bits) // 10^Scale well below 2^(Bits-1)
+class FixedDecimal {
+public:
+  using Raw = FixedInteger<Bits>;
+  static constexpr size_t scale = Scale;
+
+private:
+  using Wide = FixedInteger<2 * Bits>;
+
+  static constexpr Raw sign_bit = Raw(1) << (Bits - 1);
+
+  Raw value;
+
+  constexpr Raw magnitude() const { return is_negative() ? -value : value; }
+
+  constexpr static FixedDecimal with_sign(const Raw &magnitude,
+                                          bool negative) {
+    return from_raw(negative ? -magnitude : magnitude);
+  }
+
+public:
+  // 10^Scale, the raw value of 1
+  static constexpr Raw unit = pow10_table<Bits, Scale + 1>()[Scale];
+  // floor((2^(2 Bits) - 1) / 10^Scale)
+  static constexpr Wide reciprocal =
+      ~Wide(0) / detail::resize_fixed<2 * Bits>(unit);
+
+  // x / 10^Scale for any double-width x: a multiply-high by the reciprocal
+  // underestimates the quotient by at most two
+  static constexpr Wide divide_by_unit(const Wide &x) {
+    const Wide divisor = detail::resize_fixed<2 * Bits>(unit);
+    Wide quotient = detail::resize_fixed<2 * Bits>(
+        (detail::resize_fixed<4 * Bits>(x) *
+         detail::resize_fixed<4 * Bits>(reciprocal)) >>
+        (2 * Bits));
+    Wide remainder = x - quotient * divisor;
+    while (remainder >= divisor) {
+      ++quotient;
+      remainder -= divisor;
+    }
+    return quotient;
+  }
+
+  constexpr FixedDecimal() = default;
+
+  explicit constexpr FixedDecimal(std::integral auto integer)
+      : value(Raw(integer) * unit) {}
+
+  // Wraps a raw scaled value, i.e. raw / 10^Scale
+  static constexpr FixedDecimal from_raw(const Raw &raw) {
+    FixedDecimal result;
+    result.value = raw;
+    return result;
+  }
+
+  constexpr const Raw &raw() const { return value; }
+
+  constexpr bool is_negative() const {
+    return static_cast<bool>(value & sign_bit);
+  }
+
+  // Integer part, rounded toward zero
+  constexpr FixedDecimal truncate() const {
+    const Raw whole = detail::resize_fixed<Bits>(
+        divide_by_unit(detail::resize_fixed<2 * Bits>(magnitude())));
+    return with_sign(whole * unit, is_negative());
+  }
+
+  constexpr FixedDecimal operator+() const { return *this; }
+  constexpr FixedDecimal operator-() const { return from_raw(-value); }
+
+  constexpr FixedDecimal &operator+=(const FixedDecimal &other) {
+    value += other.value;
+    return *this;
+  }
+
+  constexpr FixedDecimal &operator-=(const FixedDecimal &other) {
+    value -= other.value;
+    return *this;
+  }
+
+  constexpr FixedDecimal &operator*=(const FixedDecimal &other) {
+    const Wide product = detail::resize_fixed<2 * Bits>(magnitude()) *
+                         detail::resize_fixed<2 * Bits>(other.magnitude());
+    return *this =
+               with_sign(detail::resize_fixed<Bits>(divide_by_unit(product)),
+                         is_negative() != other.is_negative());
+  }
+
+  constexpr FixedDecimal &operator/=(const FixedDecimal &other) {
+    const Wide scaled = detail::resize_fixed<2 * Bits>(magnitude()) *
+                        detail::resize_fixed<2 * Bits>(unit);
+    const Wide quotient =
+        scaled / detail::resize_fixed<2 * Bits>(other.magnitude());
+    return *this = with_sign(detail::resize_fixed<Bits>(quotient),
+                             is_negative() != other.is_negative());
+  }
+
+  constexpr FixedDecimal operator+(const FixedDecimal &other) const {
+    FixedDecimal result = *this;
+    return result += other;
+  }
+
+  constexpr FixedDecimal operator-(const FixedDecimal &other) const {
+    FixedDecimal result = *this;
+    return result -= other;
+  }
+
+  constexpr FixedDecimal operator*(const FixedDecimal &other) const {
+    FixedDecimal result = *this;
+    return result *= other;
+  }
+
+  constexpr FixedDecimal operator/(const FixedDecimal &other) const {
+    FixedDecimal result = *this;
+    return result /= other;
+  }
+
+  // Signed comparison: flipping the sign bit orders two's complement values
+  constexpr std::strong_ordering operator<=>(const FixedDecimal &other) const {
+    return (value ^ sign_bit) <=> (other.value ^ sign_bit);
+  }
+
+  constexpr bool operator==(const FixedDecimal &other) const = default;
+
+  explicit constexpr operator bool() const {
+    return static_cast<bool>(value);
+  }
+};
+
+// Formats with exactly Scale fractional digits, e.g. "-12.50" for Scale 2.
+// The digits come from the chunked integer conversion of the raw magnitude;
+// the decimal point is inserted Scale digits from the end.
+template <size_t Bits, size_t Scale>
+constexpr std::string to_string(const FixedDecimal<Bits, Scale> &value) {
+  const auto raw = value.is_negative() ? -value.raw() : value.raw();
+  std::string digits = to_string(raw);
+  if constexpr (Scale > 0) {
+    if (digits.size() <= Scale) {
+      digits.insert(0, Scale + 1 - digits.size(), '0');
+    }
+    digits.insert(digits.size() - Scale, 1, '.');
+  }
+  return value.is_negative() ? "-" + digits : digits;
+}
+
+// Parses "[-]digits[.digits]" with at most Scale fractional digits
+template <typename T>
+  requires detail::instantiation_of_nontype<T, FixedDecimal>
+constexpr std::optional<T> from_string(std::string_view from) {
+  const bool negative = !from.empty() && from.front() == '-';
+  if (negative) {
+    from.remove_prefix(1);
+  }
+
+  std::string_view whole = from;
+  std::string_view fraction;
+  if (auto point = from.find('.'); point != std::string_view::npos) {
+    whole = from.substr(0, point);
+    fraction = from.substr(point + 1);
+  }
+  if (whole.empty() || fraction.size() > T::scale) {
+    return std::nullopt;
+  }
+
+  std::string digits(whole);
+  digits += fraction;
+  digits.append(T::scale - fraction.size(), '0');
+  // Parsed unbounded, so oversize input is rejected instead of wrapping
+  // modulo 2^Bits; the magnitude must also leave the sign bit clear
+  auto raw = from_string<DynamicInteger>(digits);
+  if (!raw || bit_width(*raw) >= T::Raw::Bits) {
+    return std::nullopt;
+  }
+  auto result = T::from_raw(typename T::Raw(*raw));
+  return negative ? -result : result;
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,562 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <ArbitrarySeries.hpp>
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ArbitraryPrecision {
+
+enum class Rounding { nearest_even, toward_zero, down, up };
+
+namespace detail {
+constexpr bool test_bit(const DynamicInteger &value, size_t bit) {
+  auto limbs = value.as_span();
+  return bit / 64 < limbs.size() && ((limbs[bit / 64] >> (bit % 64)) & 1);
+}
+
+// log2(value) to double precision, for value > 0
+inline double log2_estimate(const DynamicInteger &value) {
+  const size_t bits = bit_width(value);
+  const size_t shift = bits > 64 ? bits - 64 : 0;
+  return std::log2(static_cast<double>((value >> shift).tail())) +
+         static_cast<double>(shift);
+}
+
+// floor(sqrt(value)) by Newton's iteration from above
+inline DynamicInteger isqrt(const DynamicInteger &value) {
+  if (!value) {
+    return value;
+  }
+  DynamicInteger x = DynamicInteger(1) << ((bit_width(value) + 1) / 2);
+  while (true) {
+    DynamicInteger y = (x + value / x) >> 1;
+    if (y >= x) {
+      return x;
+    }
+    x = std::move(y);
+  }
+}
+} // namespace detail
+
+// Binary floating point number (-1)^negative * mantissa * 2^exponent with a
+// DynamicInteger mantissa of at most `precision` bits. Every operation
+// rounds its exact result to a target precision with a Rounding mode;
+// operators use the larger operand precision and round to nearest-even.
+// Values are kept canonical (odd mantissa, or zero), so equal numbers have
+// equal representations. There are no infinities or NaNs: invalid
+// operations throw std::domain_error.
+class BigFloat {
+public:
+  static constexpr size_t default_precision = 128;
+
+  BigFloat() = default;
+
+  explicit BigFloat(std::integral auto value,
+                    size_t precision = default_precision,
+                    Rounding rounding = Rounding::nearest_even) {
+    using Unsigned = std::make_unsigned_t<decltype(value)>;
+    Unsigned magnitude = static_cast<Unsigned>(value);
+    bool negative = false;
+    if constexpr (std::is_signed_v<decltype(value)>) {
+      if (value < 0) {
+        negative = true;
+        magnitude = static_cast<Unsigned>(0) - magnitude;
+      }
+    }
+    *this = from_parts(DynamicInteger(magnitude), 0, negative, precision,
+                       rounding);
+  }
+
+  explicit BigFloat(const DynamicInteger &value,
+                    size_t precision = default_precision,
+                    Rounding rounding = Rounding::nearest_even)
+      : BigFloat(from_parts(value, 0, false, precision, rounding)) {}
+
+  // Exact whenever precision >= 53
+  explicit BigFloat(double value, size_t precision = default_precision,
+                    Rounding rounding = Rounding::nearest_even) {
+    if (!std::isfinite(value)) {
+      throw std::domain_error("BigFloat cannot represent inf or NaN");
+    }
+    int exponent = 0;
+    const double fraction = std::frexp(std::fabs(value), &exponent);
+    const auto mantissa = static_cast<uint64_t>(std::ldexp(fraction, 53));
+    *this = from_parts(DynamicInteger(mantissa), exponent - 53, value < 0,
+                       precision, rounding);
+  }
+
+  // (-1)^negative * mantissa * 2^exponent, rounded to precision
+  static BigFloat from_parts(DynamicInteger mantissa, int64_t exponent,
+                             bool negative, size_t precision,
+                             Rounding rounding = Rounding::nearest_even) {
+    if (precision == 0) {
+      throw std::domain_error("Precision must be positive");
+    }
+    BigFloat result;
+    result.precision_ = precision;
+    if (!mantissa) {
+      return result;
+    }
+
+    const size_t bits = bit_width(mantissa);
+    if (bits > precision) {
+      const size_t shift = bits - precision;
+      const bool half = detail::test_bit(mantissa, shift - 1);
+      const bool sticky = trailing_zeros(mantissa) < shift - 1;
+      mantissa >>= shift;
+      exponent += static_cast<int64_t>(shift);
+
+      bool increment = false;
+      switch (rounding) {
+      case Rounding::nearest_even:
+        increment = half && (sticky || (mantissa.tail() & 1));
+        break;
+      case Rounding::toward_zero:
+        break;
+      case Rounding::down:
+        increment = negative && (half || sticky);
+        break;
+      case Rounding::up:
+        increment = !negative && (half || sticky);
+        break;
+      }
+      if (increment) {
+        ++mantissa;
+      }
+    }
+
+    const size_t zeros = trailing_zeros(mantissa);
+    result.mantissa_ = mantissa >> zeros;
+    result.exponent_ = exponent + static_cast<int64_t>(zeros);
+    result.negative_ = negative;
+    return result;
+  }
+
+  const DynamicInteger &mantissa() const { return mantissa_; }
+  int64_t exponent() const { return exponent_; }
+  bool is_negative() const { return negative_; }
+  size_t precision() const { return precision_; }
+
+  explicit operator bool() const { return static_cast<bool>(mantissa_); }
+
+  // The same value rounded to another precision
+  BigFloat round(size_t precision,
+                 Rounding rounding = Rounding::nearest_even) const {
+    return from_parts(mantissa_, exponent_, negative_, precision, rounding);
+  }
+
+  // Nearest double (exponent range permitting)
+  double to_double() const {
+    const size_t bits = bit_width(mantissa_);
+    const size_t shift = bits > 64 ? bits - 64 : 0;
+    const auto top = static_cast<double>((mantissa_ >> shift).tail());
+    const double magnitude =
+        std::ldexp(top, static_cast<int>(exponent_ + int64_t(shift)));
+    return negative_ ? -magnitude : magnitude;
+  }
+
+  static BigFloat add(const BigFloat &lhs, const BigFloat &rhs,
+                      size_t precision,
+                      Rounding rounding = Rounding::nearest_even) {
+    if (!rhs) {
+      return lhs.round(precision, rounding);
+    }
+    if (!lhs) {
+      return rhs.round(precision, rounding);
+    }
+
+    const bool lhs_larger = lhs.top() >= rhs.top();
+    const BigFloat &large = lhs_larger ? lhs : rhs;
+    const BigFloat &small = lhs_larger ? rhs : lhs;
+
+    // Below `limit` the smaller operand can only affect the sticky bit, so
+    // it is replaced by one bit under that position
+    const int64_t limit = std::min(
+        large.top() - static_cast<int64_t>(precision) - 3, large.exponent_);
+    DynamicInteger small_mantissa = small.mantissa_;
+    int64_t small_exponent = small.exponent_;
+    if (small.top() < limit) {
+      small_mantissa = DynamicInteger(1);
+      small_exponent = limit - 1;
+    }
+
+    const int64_t exponent = std::min(large.exponent_, small_exponent);
+    DynamicInteger a = large.mantissa_ << size_t(large.exponent_ - exponent);
+    DynamicInteger b = small_mantissa << size_t(small_exponent - exponent);
+    auto [sum, negative] =
+        detail::signed_add(std::move(a), large.negative_, b, small.negative_);
+    return from_parts(std::move(sum), exponent, negative, precision,
+                      rounding);
+  }
+
+  static BigFloat multiply(const BigFloat &lhs, const BigFloat &rhs,
+                           size_t precision,
+                           Rounding rounding = Rounding::nearest_even) {
+    return from_parts(lhs.mantissa_ * rhs.mantissa_,
+                      lhs.exponent_ + rhs.exponent_,
+                      lhs.negative_ != rhs.negative_, precision, rounding);
+  }
+
+  // Forms a quotient of at least precision + 2 bits and appends a sticky
+  // bit for the remainder, so rounding sees the exact result's position
+  static BigFloat divide(const BigFloat &lhs, const BigFloat &rhs,
+                         size_t precision,
+                         Rounding rounding = Rounding::nearest_even) {
+    if (!rhs) {
+      throw std::domain_error("Division by zero");
+    }
+    if (!lhs) {
+      return BigFloat().round(precision);
+    }
+
+    const int64_t extra = static_cast<int64_t>(precision + 2) +
+                          int64_t(bit_width(rhs.mantissa_)) -
+                          int64_t(bit_width(lhs.mantissa_));
+    const size_t shift = static_cast<size_t>(std::max<int64_t>(extra, 0));
+    const DynamicInteger dividend = lhs.mantissa_ << shift;
+    DynamicInteger quotient = dividend / rhs.mantissa_;
+    const bool inexact = quotient * rhs.mantissa_ != dividend;
+    quotient <<= 1;
+    if (inexact) {
+      ++quotient;
+    }
+    return from_parts(std::move(quotient),
+                      lhs.exponent_ - rhs.exponent_ -
+                          static_cast<int64_t>(shift) - 1,
+                      lhs.negative_ != rhs.negative_, precision, rounding);
+  }
+
+  BigFloat operator+() const { return *this; }
+
+  BigFloat operator-() const {
+    BigFloat result = *this;
+    result.negative_ = !negative_ && mantissa_;
+    return result;
+  }
+
+  BigFloat &operator+=(const BigFloat &other) {
+    return *this = *this + other;
+  }
+
+  BigFloat &operator-=(const BigFloat &other) {
+    return *this = *this - other;
+  }
+
+  BigFloat &operator*=(const BigFloat &other) {
+    return *this = *this * other;
+  }
+
+  BigFloat &operator/=(const BigFloat &other) {
+    return *this = *this / other;
+  }
+
+  BigFloat operator+(const BigFloat &other) const {
+    return add(*this, other, std::max(precision_, other.precision_));
+  }
+
+  BigFloat operator-(const BigFloat &other) const {
+    return add(*this, -other, std::max(precision_, other.precision_));
+  }
+
+  BigFloat operator*(const BigFloat &other) const {
+    return multiply(*this, other, std::max(precision_, other.precision_));
+  }
+
+  BigFloat operator/(const BigFloat &other) const {
+    return divide(*this, other, std::max(precision_, other.precision_));
+  }
+
+  // Compares values; precision does not take part
+  std::strong_ordering operator<=>(const BigFloat &other) const {
+    if (negative_ != other.negative_) {
+      return negative_ ? std::strong_ordering::less
+                       : std::strong_ordering::greater;
+    }
+    const std::strong_ordering magnitude = compare_magnitude(other);
+    return negative_ ? 0 <=> magnitude : magnitude;
+  }
+
+  bool operator==(const BigFloat &other) const {
+    return negative_ == other.negative_ && exponent_ == other.exponent_ &&
+           mantissa_ == other.mantissa_;
+  }
+
+private:
+  DynamicInteger mantissa_;
+  int64_t exponent_ = 0;
+  bool negative_ = false;
+  size_t precision_ = default_precision;
+
+  // |value| < 2^top()
+  int64_t top() const {
+    return exponent_ + static_cast<int64_t>(bit_width(mantissa_));
+  }
+
+  std::strong_ordering compare_magnitude(const BigFloat &other) const {
+    if (!mantissa_ || !other.mantissa_) {
+      return static_cast<bool>(mantissa_) <=>
+             static_cast<bool>(other.mantissa_);
+    }
+    if (top() != other.top()) {
+      return top() <=> other.top();
+    }
+    const int64_t exponent = std::min(exponent_, other.exponent_);
+    return (mantissa_ << size_t(exponent_ - exponent)) <=>
+           (other.mantissa_ << size_t(other.exponent_ - exponent));
+  }
+};
+
+// Square root, correctly rounded
+inline BigFloat sqrt(const BigFloat &value, size_t precision,
+                     Rounding rounding = Rounding::nearest_even) {
+  if (value.is_negative()) {
+    throw std::domain_error("Square root of a negative number");
+  }
+  if (!value) {
+    return value.round(precision);
+  }
+
+  // Scale the mantissa to at least 2 * (precision + 2) bits with an even
+  // exponent; the remainder of the integer root becomes a sticky bit
+  const size_t bits = bit_width(value.mantissa());
+  size_t shift = 2 * (precision + 2) > bits ? 2 * (precision + 2) - bits : 0;
+  if ((value.exponent() - static_cast<int64_t>(shift)) % 2 != 0) {
+    ++shift;
+  }
+  const DynamicInteger scaled = value.mantissa() << shift;
+  DynamicInteger root = detail::isqrt(scaled);
+  const bool inexact = root * root != scaled;
+  root <<= 1;
+  if (inexact) {
+    ++root;
+  }
+  return BigFloat::from_parts(
+      std::move(root), (value.exponent() - int64_t(shift)) / 2 - 1, false,
+      precision, rounding);
+}
+
+inline BigFloat sqrt(const BigFloat &value) {
+  return sqrt(value, value.precision());
+}
+
+namespace detail {
+// Extra bits carried through the transcendental functions
+inline constexpr size_t float_guard_bits = 16;
+
+// Halvings/square roots for argument reduction, about sqrt(precision)
+inline size_t float_reduction_steps(size_t precision) {
+  return std::max<size_t>(
+      4, static_cast<size_t>(std::sqrt(static_cast<double>(precision))));
+}
+
+// exp() arguments must be below 2^float_exp_max_top in magnitude: e^x then
+// has a binary exponent of at most 1.45 * 2^62, inside int64_t
+inline constexpr int64_t float_exp_max_top = 62;
+
+// Value of a series split, t / (b * q), at the given precision
+inline BigFloat series_value(const SeriesSplit &split, size_t precision) {
+  return BigFloat::divide(
+      BigFloat::from_parts(split.t, 0, split.t_negative, precision),
+      BigFloat::from_parts(split.b * split.q, 0, false, precision),
+      precision);
+}
+
+// atanh(numerator / denominator) = sum z^(2n+1) / (2n+1) for z < 1
+inline BigFloat atanh_ratio(const DynamicInteger &numerator,
+                            const DynamicInteger &denominator,
+                            size_t precision) {
+  // Each term shrinks by at least z^2
+  const double log2_z = log2_estimate(numerator) - log2_estimate(denominator);
+  const auto terms =
+      static_cast<size_t>(static_cast<double>(precision + 4) / (-2 * log2_z)) +
+      2;
+
+  const DynamicInteger p2 = numerator * numerator;
+  const DynamicInteger q2 = denominator * denominator;
+  auto split = binary_split(
+      [&](size_t n) {
+        if (n == 0) {
+          return SeriesTerm{DynamicInteger(1), DynamicInteger(1), numerator,
+                            denominator};
+        }
+        return SeriesTerm{DynamicInteger(1), DynamicInteger(2 * n + 1), p2,
+                          q2};
+      },
+      0, terms);
+  return series_value(split, precision);
+}
+
+// ln 2 = 2 atanh(1/3)
+inline BigFloat log2_constant(size_t precision) {
+  BigFloat half = atanh_ratio(DynamicInteger(1), DynamicInteger(3), precision);
+  return BigFloat::from_parts(half.mantissa(), half.exponent() + 1, false,
+                              precision);
+}
+} // namespace detail
+
+// e^value: reduce to r = value / 2^s below 2^-sqrt(precision), sum the
+// Taylor series of e^r by binary splitting, then square s times. Throws
+// std::domain_error for |value| >= 2^62, whose result exponent would not
+// fit.
+inline BigFloat exp(const BigFloat &value, size_t precision,
+                    Rounding rounding = Rounding::nearest_even) {
+  if (!value) {
+    return BigFloat(1, precision);
+  }
+  const int64_t top =
+      value.exponent() + static_cast<int64_t>(bit_width(value.mantissa()));
+  if (top > detail::float_exp_max_top) {
+    throw std::domain_error("Exponential is out of range");
+  }
+  const int64_t target = -static_cast<int64_t>(
+      detail::float_reduction_steps(precision));
+  const size_t squarings = top > target ? size_t(top - target) : 0;
+  const size_t working = precision + squarings + detail::float_guard_bits;
+
+  // r = |value| / 2^squarings = mantissa * 2^exponent, with exponent < 0
+  const BigFloat r = BigFloat::from_parts(
+      value.mantissa(), value.exponent() - int64_t(squarings), false,
+      working, Rounding::toward_zero);
+  const int64_t r_top =
+      r.exponent() + static_cast<int64_t>(bit_width(r.mantissa()));
+  const auto r_shift = static_cast<size_t>(-r.exponent());
+
+  // Terms until r^n / n! drops below 2^-(working + 4)
+  size_t terms = 1;
+  for (double log2_term = 0; log2_term > -double(working + 4); ++terms) {
+    log2_term += double(r_top) - std::log2(double(terms));
+  }
+
+  auto split = binary_split(
+      [&](size_t n) {
+        if (n == 0) {
+          return SeriesTerm{};
+        }
+        return SeriesTerm{DynamicInteger(1), DynamicInteger(1), r.mantissa(),
+                          DynamicInteger(n) << r_shift};
+      },
+      0, terms);
+  BigFloat result = detail::series_value(split, working);
+  for (size_t i = 0; i < squarings; ++i) {
+    result = BigFloat::multiply(result, result, working);
+  }
+
+  if (value.is_negative()) {
+    return BigFloat::divide(BigFloat(1, working), result, precision,
+                            rounding);
+  }
+  return result.round(precision, rounding);
+}
+
+inline BigFloat exp(const BigFloat &value) {
+  return exp(value, value.precision());
+}
+
+// Natural logarithm: value = m * 2^k with m in [1/sqrt(2), sqrt(2)), then
+// log m = 2^(s+1) atanh((m' - 1) / (m' + 1)) where m' = m^(1/2^s) is close
+// to one, and the atanh series is summed by binary splitting. The leading
+// bits of m - 1 cancel, so the working precision grows by their count.
+inline BigFloat log(const BigFloat &value, size_t precision,
+                    Rounding rounding = Rounding::nearest_even) {
+  if (!value || value.is_negative()) {
+    throw std::domain_error("Logarithm of a non-positive number");
+  }
+  const size_t bits = bit_width(value.mantissa());
+  int64_t k = value.exponent() + static_cast<int64_t>(bits) - 1;
+  // m in [1, 2) is above sqrt(2) when its top 64 bits are
+  const DynamicInteger top = bits > 64 ? value.mantissa() >> (bits - 64)
+                                       : value.mantissa() << (64 - bits);
+  if (top.tail() >= 0xb504f333f9de6484ULL) {
+    ++k;
+  }
+  // Exact: m = mantissa * 2^(exponent - k)
+  BigFloat m = BigFloat::from_parts(value.mantissa(), value.exponent() - k,
+                                    false, bits);
+
+  // m - 1 has `lost` fewer significant bits than m
+  size_t lost = 0;
+  if (m.exponent() < 0) {
+    const DynamicInteger one = DynamicInteger(1) << size_t(-m.exponent());
+    const DynamicInteger difference =
+        m.mantissa() > one ? m.mantissa() - one : one - m.mantissa();
+    const int64_t difference_top =
+        static_cast<int64_t>(bit_width(difference)) + m.exponent();
+    lost = difference_top < 0 ? size_t(-difference_top) : 0;
+  }
+
+  const size_t roots = detail::float_reduction_steps(precision) / 2;
+  const size_t working =
+      precision + roots + lost +
+      static_cast<size_t>(std::bit_width(static_cast<uint64_t>(
+          k < 0 ? -k : k))) +
+      detail::float_guard_bits;
+  m = m.round(working);
+  for (size_t i = 0; i < roots; ++i) {
+    m = sqrt(m, working);
+  }
+
+  BigFloat result = BigFloat(0, working);
+  if (m.exponent() < 0) {
+    // m = M / 2^e, so (m - 1) / (m + 1) = (M - 2^e) / (M + 2^e)
+    const DynamicInteger one = DynamicInteger(1) << size_t(-m.exponent());
+    const bool below_one = m.mantissa() < one;
+    const BigFloat atanh = detail::atanh_ratio(
+        below_one ? one - m.mantissa() : m.mantissa() - one,
+        m.mantissa() + one, working);
+    result = BigFloat::from_parts(atanh.mantissa(),
+                                  atanh.exponent() + int64_t(roots) + 1,
+                                  below_one, working);
+  }
+  if (k != 0) {
+    const BigFloat log2 = detail::log2_constant(working);
+    result = BigFloat::add(result,
+                           BigFloat::multiply(log2, BigFloat(k, working),
+                                              working),
+                           working);
+  }
+  return result.round(precision, rounding);
+}
+
+inline BigFloat log(const BigFloat &value) {
+  return log(value, value.precision());
+}
+
+// Fixed notation with `fractional_digits` digits after the point, rounded
+// half away from zero
+inline std::string to_string(const BigFloat &value, size_t fractional_digits) {
+  DynamicInteger scaled = value.mantissa();
+  for (size_t remaining = fractional_digits; remaining > 0;) {
+    const size_t count = std::min(remaining, limb_decimal_digits);
+    scaled *= DynamicInteger(limb_pow10[count]);
+    remaining -= count;
+  }
+  if (value.exponent() >= 0) {
+    scaled <<= size_t(value.exponent());
+  } else {
+    const auto shift = static_cast<size_t>(-value.exponent());
+    scaled = (scaled + (DynamicInteger(1) << (shift - 1))) >> shift;
+  }
+
+  std::string digits = to_string(scaled);
+  if (fractional_digits > 0) {
+    if (digits.size() <= fractional_digits) {
+      digits.insert(0, fractional_digits + 1 - digits.size(), '0');
+    }
+    digits.insert(digits.size() - fractional_digits, 1, '.');
+  }
+  return value.is_negative() && scaled ? "-" + digits : digits;
+}
+
+// As many fractional digits as the precision resolves
+inline std::string to_string(const BigFloat &value) {
+  return to_string(value, static_cast<size_t>(
+                              double(value.precision()) * 0.30102999566398));
+}
+
+} // namespace ArbitraryPrecision
@@ -1,16 +1,22 @@
+#pragma once
+
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cassert>
 #include <climits>
 #include <compare>
 #include <concepts>
 #include <cstdint>
+#include <optional>
 #include <span>
 #include <stdexcept>
+#include <stop_token>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 static_assert(CHAR_BIT == 8);
@@ -26,8 +32,142 @@ struct instantiation_of_nontype_impl<C<Args...>, C> : std::true_type {};
 
 template <typename T, template <auto...> class C>
 concept instantiation_of_nontype = instantiation_of_nontype_impl<T, C>::value;
+
+// Hash of a little-endian limb sequence (splitmix64 finalizer per limb)
+constexpr size_t hash_limbs(std::span<const uint64_t> limbs) {
+  uint64_t hash = 0x9e3779b97f4a7c15ULL ^ limbs.size();
+  for (uint64_t limb : limbs) {
+    hash ^= limb;
+    hash += 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+  }
+  return static_cast<size_t>(hash);
+}
+
+// Index of the only set bit in limbs, or nullopt unless exactly one bit is
+// set; one popcount per nonzero limb
+constexpr std::optional<size_t>
+single_bit_index(std::span<const uint64_t> limbs) {
+  std::optional<size_t> index;
+  for (size_t i = 0; i < limbs.size(); ++i) {
+    if (!limbs[i]) {
+      continue;
+    }
+    if (index || std::popcount(limbs[i]) != 1) {
+      return std::nullopt;
+    }
+    index = i * 64 + static_cast<size_t>(std::countr_zero(limbs[i]));
+  }
+  return index;
+}
+} // namespace detail
+
+// Cooperative cancellation of long-running operations. While a StopScope is
+// active on a thread, every traced operation that thread starts (see trace
+// below), each block of rows of operator* and each window of a Montgomery
+// exponentiation is a cancellation point: once stop is requested it throws
+// OperationCancelled. Points only occur before an in-place operand is
+// modified, so a cancelled operation leaves its operands intact. Threads
+// without a StopScope never throw.
+class OperationCancelled : public std::runtime_error {
+public:
+  OperationCancelled() : std::runtime_error("Operation cancelled") {}
+};
+
+namespace detail {
+inline thread_local const std::stop_token *active_stop_token = nullptr;
 } // namespace detail
 
+// Throws OperationCancelled if the calling thread's stop token was triggered
+constexpr void cancellation_point() {
+  if !consteval {
+    const std::stop_token *stop = detail::active_stop_token;
+    if (stop && stop->stop_requested()) {
+      throw OperationCancelled();
+    }
+  }
+}
+
+// Installs `stop` as the calling thread's stop token until destruction
+class StopScope {
+public:
+  explicit StopScope(const std::stop_token &stop)
+      : previous(std::exchange(detail::active_stop_token, &stop)) {}
+  ~StopScope() { detail::active_stop_token = previous; }
+
+  StopScope(const StopScope &) = delete;
+  StopScope &operator=(const StopScope &) = delete;
+
+private:
+  const std::stop_token *previous;
+};
+
+// Optional tracing of long-running operations. Install a Hooks table with
+// trace::set_hooks() to receive begin/end callbacks from the multiplication,
+// division and string conversion routines; with no hooks installed the cost
+// is a single atomic load per operation.
+namespace trace {
+struct Event {
+  std::string_view operation; // e.g. "multiply", "divide", "to_string"
+  std::string_view algorithm; // algorithm tier, e.g. "schoolbook"
+  size_t lhs_limbs;
+  size_t rhs_limbs;
+};
+
+using Callback = void (*)(const Event &event, void *user);
+
+struct Hooks {
+  Callback begin = nullptr;
+  Callback end = nullptr;
+  void *user = nullptr;
+  // Operations whose operands are all smaller than this are not reported
+  size_t min_limbs = 0;
+};
+
+inline std::atomic<const Hooks *> active_hooks{nullptr};
+
+// Installs `hooks` (or disables tracing with nullptr). The table must outlive
+// every traced operation started while it is installed.
+inline void set_hooks(const Hooks *hooks) {
+  active_hooks.store(hooks, std::memory_order_release);
+}
+
+// RAII helper emitting begin on construction and end on destruction
+class Scope {
+public:
+  // Constant evaluation never reports events
+  constexpr Scope(std::string_view operation, std::string_view algorithm,
+                  size_t lhs_limbs, size_t rhs_limbs)
+      : event{operation, algorithm, lhs_limbs, rhs_limbs} {
+    if !consteval {
+      cancellation_point();
+      hooks = active_hooks.load(std::memory_order_acquire);
+      if (hooks && std::max(lhs_limbs, rhs_limbs) < hooks->min_limbs) {
+        hooks = nullptr;
+      }
+      if (hooks && hooks->begin) {
+        hooks->begin(event, hooks->user);
+      }
+    }
+  }
+
+  constexpr ~Scope() {
+    if (hooks && hooks->end) {
+      hooks->end(event, hooks->user);
+    }
+  }
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+private:
+  const Hooks *hooks = nullptr;
+  Event event;
+};
+} // namespace trace
+
 template <size_t Bits>
   requires(std::has_single_bit(Bits) && (Bits > 64))
 class FixedInteger;
@@ -38,6 +178,9 @@ template <typename T>
 concept Integer = detail::instantiation_of_nontype<T, FixedInteger> ||
                   std::is_same_v<T, DynamicInteger>;
 
+// x mod 2^k, defined below; division by a power of two reduces to it
+template <Integer T> constexpr T mod_pow2(const T &x, size_t k);
+
 // Fixed precision
 template <size_t Bits_>
   requires(std::has_single_bit(Bits_) && (Bits_ > 64))
@@ -376,7 +519,7 @@ public:
   }
 
   // Conversion to bool
-  constexpr explicit operator bool() const {
+  explicit constexpr operator bool() const {
     for (const auto &seg : segments) {
       if (seg != 0)
         return true;
@@ -388,11 +531,11 @@ public:
   constexpr uint64_t tail() const { return segments[0]; }
 
   constexpr std::span<Chunk, (Bits / 64)> as_span() {
-    return std::span{segments.begin(), segments.size()};
+    return std::span<Chunk, (Bits / 64)>{segments};
   }
 
   constexpr std::span<const Chunk, (Bits / 64)> as_span() const {
-    return std::span{segments.begin(), segments.size()};
+    return std::span<const Chunk, (Bits / 64)>{segments};
   }
 
 private:
@@ -402,6 +545,10 @@ private:
     if (!divisor) {
       throw std::domain_error("Division by zero");
     }
+    // A single set bit divides as a shift and a mask
+    if (const auto shift = detail::single_bit_index(divisor.as_span())) {
+      return {dividend >> *shift, mod_pow2(dividend, *shift)};
+    }
 
     FixedInteger quotient;
     FixedInteger remainder;
@@ -437,21 +584,22 @@ public:
 private:
   Segments segments;
   // Helper: add with carry
-  static bool add_with_carry(uint64_t &result, uint64_t a, uint64_t b,
-                             bool carry_in) {
+  static constexpr bool add_with_carry(uint64_t &result, uint64_t a, uint64_t b,
+                                       bool carry_in) {
     result = a + b + (carry_in ? 1 : 0);
     return result < a || (carry_in && result == a);
   }
 
   // Helper: subtract with borrow
-  static bool sub_with_borrow(uint64_t &result, uint64_t a, uint64_t b,
-                              bool borrow_in) {
+  static constexpr bool sub_with_borrow(uint64_t &result, uint64_t a,
+                                        uint64_t b, bool borrow_in) {
     result = a - b - (borrow_in ? 1 : 0);
     return b > a || (borrow_in && b == a);
   }
 
   // Helper: multiply 64-bit numbers to get 128-bit result
-  static std::pair<uint64_t, uint64_t> mul128(uint64_t a, uint64_t b) {
+  static constexpr std::pair<uint64_t, uint64_t> mul128(uint64_t a,
+                                                        uint64_t b) {
     uint64_t a_lo = a & 0xFFFFFFFF;
     uint64_t a_hi = a >> 32;
     uint64_t b_lo = b & 0xFFFFFFFF;
@@ -473,20 +621,22 @@ private:
   }
 
   // Helper: trim leading zeros (keep at least 1 segment)
-  void trim() {
+  constexpr void trim() {
     while (segments.size() > 1 && segments.back() == 0) {
       segments.pop_back();
     }
   }
 
 public:
-  DynamicInteger() : segments(1, 0) {}
+  constexpr DynamicInteger() : segments(1, 0) {}
 
-  size_t length() const { return segments.size(); }
-  size_t bits() const { return length() * (sizeof(Chunk) * CHAR_BIT); }
+  constexpr size_t length() const { return segments.size(); }
+  constexpr size_t bits() const {
+    return length() * (sizeof(Chunk) * CHAR_BIT);
+  }
 
   // Constructor from integral types
-  explicit DynamicInteger(std::integral auto value) : segments(1, 0) {
+  explicit constexpr DynamicInteger(std::integral auto value) : segments(1, 0) {
     static_assert(sizeof(decltype(value)) <= sizeof(Chunk),
                   "Integral value cannot be larger than Chunk value");
     // Simply cast the value to Chunk - for signed negative values,
@@ -495,14 +645,23 @@ public:
     segments[0] = static_cast<Chunk>(value);
   }
 
+  // Constructor from little-endian limbs
+  explicit constexpr DynamicInteger(std::span<const Chunk> limbs)
+      : segments(limbs.begin(), limbs.end()) {
+    if (segments.empty()) {
+      segments.push_back(0);
+    }
+    trim();
+  }
+
   // Constructor from Fixed Integer (forward declaration)
   template <size_t Bits>
-  explicit DynamicInteger(const FixedInteger<Bits> &value);
+  explicit constexpr DynamicInteger(const FixedInteger<Bits> &value);
 
   // Unary operators
-  DynamicInteger operator+() const { return *this; }
+  constexpr DynamicInteger operator+() const { return *this; }
 
-  DynamicInteger operator-() const {
+  constexpr DynamicInteger operator-() const {
     DynamicInteger result;
     result.segments.resize(length());
     bool borrow = false;
@@ -514,7 +673,7 @@ public:
     return result;
   }
 
-  DynamicInteger operator~() const {
+  constexpr DynamicInteger operator~() const {
     DynamicInteger result;
     result.segments.resize(length());
     for (size_t i = 0; i < length(); ++i) {
@@ -524,7 +683,7 @@ public:
   }
 
   // Addition
-  DynamicInteger &operator+=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator+=(const DynamicInteger &other) {
     size_t max_len = std::max(length(), other.length());
     segments.resize(max_len, 0);
 
@@ -543,14 +702,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator+(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator+(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result += other;
     return result;
   }
 
   // Subtraction
-  DynamicInteger &operator-=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator-=(const DynamicInteger &other) {
     size_t max_len = std::max(length(), other.length());
     segments.resize(max_len, 0);
 
@@ -564,18 +723,22 @@ public:
     return *this;
   }
 
-  DynamicInteger operator-(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator-(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result -= other;
     return result;
   }
 
   // Multiplication
-  DynamicInteger &operator*=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator*=(const DynamicInteger &other) {
+    trace::Scope scope("multiply", "schoolbook", length(), other.length());
     DynamicInteger result;
     result.segments.resize(length() + other.length(), 0);
 
     for (size_t i = 0; i < length(); ++i) {
+      if (i % cancellation_rows == cancellation_rows - 1) {
+        cancellation_point();
+      }
       Chunk carry = 0;
       for (size_t j = 0; j < other.length(); ++j) {
         if (i + j >= result.length())
@@ -599,34 +762,69 @@ public:
     return *this;
   }
 
-  DynamicInteger operator*(const DynamicInteger &other) const {
+  // Fused *this += a * b: partial products are accumulated straight into
+  // this value's limbs, with no temporary for the product
+  constexpr DynamicInteger &add_product(const DynamicInteger &a,
+                                        const DynamicInteger &b) {
+    if (this == &a || this == &b) {
+      return *this += a * b;
+    }
+    if (!a || !b) {
+      return *this;
+    }
+    trace::Scope scope("multiply", "addmul", a.length(), b.length());
+    segments.resize(std::max(length(), a.length() + b.length()) + 1, 0);
+
+    // No cancellation points past the trace scope: the limbs are updated
+    // in place, and a throw here would leave a partial, untrimmed sum
+    for (size_t i = 0; i < a.length(); ++i) {
+      Chunk carry = 0;
+      for (size_t j = 0; j < b.length(); ++j) {
+        auto [lo, hi] = mul128(a.segments[i], b.segments[j]);
+
+        bool c1 = add_with_carry(lo, lo, carry, false);
+        bool c2 = add_with_carry(lo, lo, segments[i + j], false);
+
+        segments[i + j] = lo;
+        carry = hi + c1 + c2;
+      }
+      for (size_t k = i + b.length(); carry; ++k) {
+        carry = add_with_carry(segments[k], segments[k], carry, false);
+      }
+    }
+
+    trim();
+    return *this;
+  }
+
+  constexpr DynamicInteger operator*(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result *= other;
     return result;
   }
 
   // Division (unsigned division algorithm)
-  DynamicInteger &operator/=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator/=(const DynamicInteger &other) {
     *this = divide(*this, other).first;
     return *this;
   }
 
-  DynamicInteger operator/(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator/(const DynamicInteger &other) const {
     return divide(*this, other).first;
   }
 
   // Modulo
-  DynamicInteger &operator%=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator%=(const DynamicInteger &other) {
     *this = divide(*this, other).second;
     return *this;
   }
 
-  DynamicInteger operator%(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator%(const DynamicInteger &other) const {
     return divide(*this, other).second;
   }
 
   // Bitwise AND
-  DynamicInteger &operator&=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator&=(const DynamicInteger &other) {
     size_t min_len = std::min(length(), other.length());
     segments.resize(min_len);
     for (size_t i = 0; i < min_len; ++i) {
@@ -636,14 +834,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator&(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator&(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result &= other;
     return result;
   }
 
   // Bitwise OR
-  DynamicInteger &operator|=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator|=(const DynamicInteger &other) {
     size_t max_len = std::max(length(), other.length());
     segments.resize(max_len, 0);
     for (size_t i = 0; i < other.length(); ++i) {
@@ -653,14 +851,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator|(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator|(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result |= other;
     return result;
   }
 
   // Bitwise XOR
-  DynamicInteger &operator^=(const DynamicInteger &other) {
+  constexpr DynamicInteger &operator^=(const DynamicInteger &other) {
     size_t max_len = std::max(length(), other.length());
     segments.resize(max_len, 0);
     for (size_t i = 0; i < other.length(); ++i) {
@@ -670,14 +868,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator^(const DynamicInteger &other) const {
+  constexpr DynamicInteger operator^(const DynamicInteger &other) const {
     DynamicInteger result = *this;
     result ^= other;
     return result;
   }
 
   // Left shift
-  DynamicInteger &operator<<=(size_t shift) {
+  constexpr DynamicInteger &operator<<=(size_t shift) {
     if (shift == 0)
       return *this;
 
@@ -722,14 +920,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator<<(size_t shift) const {
+  constexpr DynamicInteger operator<<(size_t shift) const {
     DynamicInteger result = *this;
     result <<= shift;
     return result;
   }
 
   // Right shift (logical)
-  DynamicInteger &operator>>=(size_t shift) {
+  constexpr DynamicInteger &operator>>=(size_t shift) {
     if (shift == 0)
       return *this;
 
@@ -761,14 +959,14 @@ public:
     return *this;
   }
 
-  DynamicInteger operator>>(size_t shift) const {
+  constexpr DynamicInteger operator>>(size_t shift) const {
     DynamicInteger result = *this;
     result >>= shift;
     return result;
   }
 
   // Increment/Decrement
-  DynamicInteger &operator++() {
+  constexpr DynamicInteger &operator++() {
     for (size_t i = 0; i < length(); ++i) {
       if (++segments[i] != 0)
         return *this;
@@ -778,13 +976,13 @@ public:
     return *this;
   }
 
-  DynamicInteger operator++(int) {
+  constexpr DynamicInteger operator++(int) {
     DynamicInteger temp = *this;
     ++(*this);
     return temp;
   }
 
-  DynamicInteger &operator--() {
+  constexpr DynamicInteger &operator--() {
     for (size_t i = 0; i < length(); ++i) {
       if (segments[i]-- != 0) {
         trim();
@@ -795,14 +993,15 @@ public:
     return *this;
   }
 
-  DynamicInteger operator--(int) {
+  constexpr DynamicInteger operator--(int) {
     DynamicInteger temp = *this;
     --(*this);
     return temp;
   }
 
   // Spaceship operator
-  std::strong_ordering operator<=>(const DynamicInteger &other) const {
+  constexpr std::strong_ordering
+  operator<=>(const DynamicInteger &other) const {
     if (length() != other.length()) {
       return length() <=> other.length();
     }
@@ -814,12 +1013,12 @@ public:
     return std::strong_ordering::equal;
   }
 
-  bool operator==(const DynamicInteger &other) const {
+  constexpr bool operator==(const DynamicInteger &other) const {
     return segments == other.segments;
   }
 
   // Conversion to bool
-  explicit operator bool() const {
+  explicit constexpr operator bool() const {
     for (const auto &seg : segments) {
       if (seg != 0)
         return true;
@@ -828,7 +1027,7 @@ public:
   }
 
   // Returns lowest 64 bits
-  uint64_t tail() const { return segments[0]; }
+  constexpr uint64_t tail() const { return segments[0]; }
 
   constexpr std::span<Chunk, std::dynamic_extent> as_span() {
     return std::span{segments.begin(), segments.size()};
@@ -839,12 +1038,95 @@ public:
   }
 
 private:
+  // Divisors with at least this many limbs use Newton division
+  static constexpr size_t newton_division_threshold = 3;
+
+  // Schoolbook multiplication rows between cancellation points
+  static constexpr size_t cancellation_rows = 32;
+
+  // Number of significant bits (0 for zero)
+  static constexpr size_t significant_bits(const DynamicInteger &value) {
+    return value.length() * 64 -
+           static_cast<size_t>(std::countl_zero(value.segments.back()));
+  }
+
+  // floor(2^(n - 1 + precision) / divisor) to within two units, where n is
+  // the bit length of divisor. Each Newton step doubles the precision of a
+  // half-precision estimate, and only the top precision + 4 bits of the
+  // divisor take part, so the cost is dominated by the final step.
+  static constexpr DynamicInteger reciprocal(const DynamicInteger &divisor,
+                                             size_t precision) {
+    const size_t n = significant_bits(divisor);
+    if (n > precision + 4) {
+      return reciprocal(divisor >> (n - precision - 4), precision);
+    }
+    if (precision <= 60) {
+      // At most 124 / 64 bits: the bit-serial divider is cheap here
+      return (DynamicInteger(1) << (n - 1 + precision)) / divisor;
+    }
+
+    // x ~ 2^(n - 1 + half) / divisor, e = 2^(n - 1 + half) - divisor * x,
+    // and the refined estimate is x * 2^(precision - half) + x * e / 2^shift
+    const size_t half = precision / 2 + 4;
+    const DynamicInteger x = reciprocal(divisor, half);
+    const DynamicInteger one = DynamicInteger(1) << (n - 1 + half);
+    const DynamicInteger product = divisor * x;
+    const size_t shift = n - 1 + 2 * half - precision;
+    DynamicInteger result = x << (precision - half);
+    if (product <= one) {
+      result += (x * (one - product)) >> shift;
+    } else {
+      result -= (x * (product - one)) >> shift;
+    }
+    return result;
+  }
+
+  // Quotient from the reciprocal estimate (off by at most two), then fixed
+  // up against the exact remainder
+  static constexpr std::pair<DynamicInteger, DynamicInteger>
+  newton_divide(const DynamicInteger &dividend,
+                const DynamicInteger &divisor) {
+    const size_t m = significant_bits(dividend);
+    const size_t n = significant_bits(divisor);
+    if (m < n) {
+      return {DynamicInteger(), dividend};
+    }
+
+    const size_t precision = m - n + 4;
+    DynamicInteger quotient =
+        (dividend * reciprocal(divisor, precision)) >> (n - 1 + precision);
+    DynamicInteger product = quotient * divisor;
+    while (product > dividend) {
+      --quotient;
+      product -= divisor;
+    }
+    DynamicInteger remainder = dividend - product;
+    while (remainder >= divisor) {
+      ++quotient;
+      remainder -= divisor;
+    }
+    return {quotient, remainder};
+  }
+
   // Helper for division
-  static std::pair<DynamicInteger, DynamicInteger>
+  static constexpr std::pair<DynamicInteger, DynamicInteger>
   divide(const DynamicInteger &dividend, const DynamicInteger &divisor) {
     if (!divisor) {
       throw std::domain_error("Division by zero");
     }
+    // A single set bit divides as a shift and a mask
+    if (const auto shift = detail::single_bit_index(divisor.as_span())) {
+      trace::Scope scope("divide", "shift", dividend.length(),
+                         divisor.length());
+      return {dividend >> *shift, mod_pow2(dividend, *shift)};
+    }
+    if (divisor.length() >= newton_division_threshold) {
+      trace::Scope scope("divide", "newton", dividend.length(),
+                         divisor.length());
+      return newton_divide(dividend, divisor);
+    }
+    trace::Scope scope("divide", "bit-serial", dividend.length(),
+                       divisor.length());
 
     DynamicInteger quotient;
     DynamicInteger remainder;
@@ -891,7 +1173,7 @@ constexpr FixedInteger<Bits_>::FixedInteger(const DynamicInteger &value) {
 };
 
 template <size_t Bits_>
-DynamicInteger::DynamicInteger(const FixedInteger<Bits_> &value) {
+constexpr DynamicInteger::DynamicInteger(const FixedInteger<Bits_> &value) {
   // assume vector is already empty (we are in constructor)
   auto segments = value.as_span();
   std::copy(segments.begin(), segments.end(),
@@ -899,21 +1181,213 @@ DynamicInteger::DynamicInteger(const FixedInteger<Bits_> &value) {
   this->trim();
 };
 
+// Compile-time constant tables
+//
+// The generators below are constexpr so tables can be built once by the
+// compiler, e.g.
+//   constexpr auto powers = pow10_table<256, 78>();
+//   constexpr auto mont = montgomery_constants(FixedInteger<256>(...));
+
+// Largest power of ten that fits in a 64-bit limb is 10^19
+inline constexpr size_t limb_decimal_digits = 19;
+
+// 10^0 .. 10^19 as single limbs, used by string conversion
+inline constexpr std::array<uint64_t, limb_decimal_digits + 1> limb_pow10 =
+    [] {
+      std::array<uint64_t, limb_decimal_digits + 1> table{};
+      uint64_t power = 1;
+      for (auto &entry : table) {
+        entry = power;
+        power *= 10;
+      }
+      return table;
+    }();
+
+// 10^0 .. 10^(N-1); entries wrap modulo 2^Bits past digits10
+template <size_t Bits, size_t N>
+constexpr std::array<FixedInteger<Bits>, N> pow10_table() {
+  std::array<FixedInteger<Bits>, N> table{};
+  FixedInteger<Bits> power(1);
+  const FixedInteger<Bits> ten(10);
+  for (auto &entry : table) {
+    entry = power;
+    power *= ten;
+  }
+  return table;
+}
+
+namespace detail {
+// Zero-extends or truncates a FixedInteger to another width
+template <size_t To, size_t From>
+constexpr FixedInteger<To> resize_fixed(const FixedInteger<From> &value) {
+  FixedInteger<To> result;
+  auto source = value.as_span();
+  auto target = result.as_span();
+  std::copy_n(source.begin(), std::min(source.size(), target.size()),
+              target.begin());
+  return result;
+}
+
+// (a + a) mod m for a < m, without needing a wider type
+template <size_t Bits>
+constexpr FixedInteger<Bits> mod_double(const FixedInteger<Bits> &a,
+                                        const FixedInteger<Bits> &m) {
+  FixedInteger<Bits> sum = a + a;
+  if (sum < a || sum >= m) {
+    sum -= m;
+  }
+  return sum;
+}
+
+// Inverse of an odd limb modulo 2^64 by Newton iteration
+constexpr uint64_t limb_inverse(uint64_t odd) {
+  uint64_t inverse = (3 * odd) ^ 2; // correct to 5 bits
+  for (int i = 0; i < 4; ++i) {
+    inverse *= 2 - odd * inverse;
+  }
+  return inverse;
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using uint128 = unsigned __int128;
+#endif
+
+// High limb of the 128-bit product a * b
+constexpr uint64_t mul_high(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>(static_cast<uint128>(a) * b >> 64);
+#else
+  const uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+  const uint64_t cross =
+      (a_lo * b_lo >> 32) + (a_hi * b_lo & 0xFFFFFFFF) + a_lo * b_hi;
+  return a_hi * b_hi + (a_hi * b_lo >> 32) + (cross >> 32);
+#endif
+}
+
+// a * b + c + d as {low, high} limbs; the sum always fits in 128 bits
+constexpr std::pair<uint64_t, uint64_t> mul_add(uint64_t a, uint64_t b,
+                                                uint64_t c, uint64_t d) {
+#if defined(__SIZEOF_INT128__)
+  const uint128 sum = static_cast<uint128>(a) * b + c + d;
+  return {static_cast<uint64_t>(sum), static_cast<uint64_t>(sum >> 64)};
+#else
+  uint64_t low = a * b;
+  uint64_t high = mul_high(a, b);
+  low += c;
+  high += low < c;
+  low += d;
+  high += low < d;
+  return {low, high};
+#endif
+}
+} // namespace detail
+
+// 2^(stride * i) mod modulus for i = 0 .. N-1
+template <size_t Bits, size_t N>
+constexpr std::array<FixedInteger<Bits>, N>
+pow2_residue_table(const FixedInteger<Bits> &modulus, size_t stride = 64) {
+  if (!modulus) {
+    throw std::domain_error("Division by zero");
+  }
+  std::array<FixedInteger<Bits>, N> table{};
+  FixedInteger<Bits> power = FixedInteger<Bits>(1) % modulus;
+  for (auto &entry : table) {
+    entry = power;
+    for (size_t i = 0; i < stride; ++i) {
+      power = detail::mod_double(power, modulus);
+    }
+  }
+  return table;
+}
+
+// First N odd primes (3, 5, 7, ...)
+template <size_t N> constexpr std::array<uint64_t, N> small_primes() {
+  std::array<uint64_t, N> primes{};
+  size_t count = 0;
+  for (uint64_t candidate = 3; count < N; candidate += 2) {
+    bool prime = true;
+    for (size_t i = 0; i < count && primes[i] * primes[i] <= candidate; ++i) {
+      if (candidate % primes[i] == 0) {
+        prime = false;
+        break;
+      }
+    }
+    if (prime) {
+      primes[count++] = candidate;
+    }
+  }
+  return primes;
+}
+
+// Inverses of the first N odd primes modulo 2^Bits. Multiplying by one of
+// these divides exactly when the prime divides the value.
+template <size_t Bits, size_t N>
+constexpr std::array<FixedInteger<Bits>, N> small_prime_inverse_table() {
+  constexpr auto primes = small_primes<N>();
+  std::array<FixedInteger<Bits>, N> table{};
+  const FixedInteger<Bits> two(2);
+  for (size_t i = 0; i < N; ++i) {
+    const FixedInteger<Bits> p(primes[i]);
+    // Each Newton step doubles the number of correct low bits
+    FixedInteger<Bits> inverse(detail::limb_inverse(primes[i]));
+    for (size_t bits = 64; bits < Bits; bits *= 2) {
+      inverse *= two - p * inverse;
+    }
+    table[i] = inverse;
+  }
+  return table;
+}
+
+// Constants for Montgomery arithmetic with R = 2^Bits
+template <size_t Bits> struct MontgomeryConstants {
+  FixedInteger<Bits> modulus;
+  FixedInteger<Bits> r;  // R mod modulus
+  FixedInteger<Bits> r2; // R^2 mod modulus
+  uint64_t inverse;      // -modulus^-1 mod 2^64
+};
+
+template <size_t Bits>
+constexpr MontgomeryConstants<Bits>
+montgomery_constants(const FixedInteger<Bits> &modulus) {
+  if ((modulus.tail() & 1) == 0) {
+    throw std::domain_error("Montgomery modulus must be odd");
+  }
+  MontgomeryConstants<Bits> constants;
+  constants.modulus = modulus;
+  // 2^Bits - modulus is congruent to R
+  constants.r = (-modulus) % modulus;
+  constants.r2 = constants.r;
+  for (size_t i = 0; i < Bits; ++i) {
+    constants.r2 = detail::mod_double(constants.r2, modulus);
+  }
+  constants.inverse = 0 - detail::limb_inverse(modulus.tail());
+  return constants;
+}
+
 // Convert Integer to decimal string
-std::string to_string(const Integer auto &value) {
+constexpr std::string to_string(const Integer auto &value) {
 
   if (!value) {
     return "0";
   }
+  trace::Scope scope("to_string", "limb-chunked", value.length(), 1);
 
+  // Peel off 19 digits per division by 10^19, then format each chunk
+  // natively; all but the most significant chunk are zero-padded
   std::string result;
   Integer auto temp = value;
-  const decltype(temp) ten(10);
+  const decltype(temp) chunk_divisor(limb_pow10[limb_decimal_digits]);
 
   while (temp) {
-    Integer auto digit = temp % ten;
-    result += static_cast<char>('0' + digit.tail());
-    temp /= ten;
+    Integer auto quotient = temp / chunk_divisor;
+    uint64_t chunk = (temp - quotient * chunk_divisor).tail();
+    temp = quotient;
+
+    for (size_t i = 0; i < limb_decimal_digits && (chunk || temp); ++i) {
+      result += static_cast<char>('0' + chunk % 10);
+      chunk /= 10;
+    }
   }
 
   std::reverse(result.begin(), result.end());
@@ -921,26 +1395,441 @@ std::string to_string(const Integer auto &value) {
 }
 
 // Convert string to Integer
-template <Integer T> std::optional<T> from_string(std::string_view from) {
+template <Integer T>
+constexpr std::optional<T> from_string(std::string_view from) {
   if (from.empty()) {
     return std::nullopt;
   }
+  trace::Scope scope("from_string", "limb-chunked",
+                     (from.size() + limb_decimal_digits - 1) /
+                         limb_decimal_digits,
+                     1);
 
+  // Horner's scheme over chunks of up to 19 digits
   T result(0);
-  const T ten(10);
 
-  for (char c : from) {
-    if (c < '0' || c > '9') {
-      return std::nullopt;
+  while (!from.empty()) {
+    const size_t count = std::min(from.size(), limb_decimal_digits);
+    uint64_t chunk = 0;
+    for (char c : from.substr(0, count)) {
+      if (c < '0' || c > '9') {
+        return std::nullopt;
+      }
+      chunk = chunk * 10 + static_cast<uint64_t>(c - '0');
+    }
+    from.remove_prefix(count);
+
+    result *= T(limb_pow10[count]);
+    result += T(chunk);
+  }
+
+  return result;
+}
+
+// Number of significant bits (0 for zero)
+constexpr size_t bit_width(const Integer auto &value) {
+  auto limbs = value.as_span();
+  for (size_t i = limbs.size(); i > 0; --i) {
+    if (limbs[i - 1]) {
+      return (i - 1) * 64 + static_cast<size_t>(std::bit_width(limbs[i - 1]));
+    }
+  }
+  return 0;
+}
+
+// Number of trailing zero bits (0 for zero)
+constexpr size_t trailing_zeros(const Integer auto &value) {
+  auto limbs = value.as_span();
+  for (size_t i = 0; i < limbs.size(); ++i) {
+    if (limbs[i]) {
+      return i * 64 + static_cast<size_t>(std::countr_zero(limbs[i]));
+    }
+  }
+  return 0;
+}
+
+// x mod 2^k: the low k bits of x, copied without dividing
+template <Integer T> constexpr T mod_pow2(const T &x, size_t k) {
+  const auto limbs = x.as_span();
+  // Checked against the limb count too, so top is visibly in bounds
+  if (k >= limbs.size() * 64 || k >= bit_width(x)) {
+    return x;
+  }
+  const size_t top = k / 64;
+  const uint64_t mask = (uint64_t(1) << (k % 64)) - 1;
+  if constexpr (T::is_dynamic) {
+    std::vector<uint64_t> low(limbs.begin(), limbs.begin() + top + 1);
+    low.back() &= mask;
+    return T(std::span<const uint64_t>(low));
+  } else {
+    T result;
+    auto target = result.as_span();
+    std::copy_n(limbs.begin(), top, target.begin());
+    target[top] = limbs[top] & mask;
+    return result;
+  }
+}
+
+// x / 2^k, a plain right shift
+template <Integer T> constexpr T div_pow2(const T &x, size_t k) {
+  return x >> k;
+}
+
+// Greatest common divisor by the binary (Stein) algorithm, which only needs
+// shifts and subtractions rather than the bit-serial divider
+template <Integer T> constexpr T gcd(T a, T b) {
+  if (!a) {
+    return b;
+  }
+  if (!b) {
+    return a;
+  }
+  trace::Scope scope("gcd", "binary", a.length(), b.length());
+
+  const size_t shift = std::min(trailing_zeros(a), trailing_zeros(b));
+  a >>= trailing_zeros(a);
+  do {
+    b >>= trailing_zeros(b);
+    if (a > b) {
+      std::swap(a, b);
+    }
+    b -= a;
+  } while (b);
+  return a << shift;
+}
+
+// a^-1 mod m by the binary extended Euclidean algorithm: halvings and
+// subtractions with the cofactors kept in [0, m). Throws std::domain_error
+// when gcd(a, m) != 1.
+template <Integer T> constexpr T modinv(const T &a, const T &m) {
+  if (!m) {
+    throw std::domain_error("Division by zero");
+  }
+  if (m == T(1)) {
+    return T(0);
+  }
+  if (!(m.tail() & 1)) {
+    // Even m needs odd a; with y = m^-1 mod a, (1 + m (a - y)) / a is the
+    // inverse, computed wide enough not to overflow
+    if (!(a.tail() & 1)) {
+      throw std::domain_error("Value is not invertible");
+    }
+    const DynamicInteger wide_a(a);
+    const DynamicInteger wide_m(m);
+    const DynamicInteger reduced = wide_a % wide_m;
+    if (reduced == DynamicInteger(1)) {
+      return T(1);
+    }
+    const DynamicInteger y = modinv(wide_m % reduced, reduced);
+    return T((DynamicInteger(1) + wide_m * (reduced - y)) / reduced);
+  }
+  trace::Scope scope("modinv", "binary", a.length(), m.length());
+
+  // x1 a = u and x2 a = v (mod m) throughout
+  T u = a % m;
+  T v = m;
+  T x1(1);
+  T x2(0);
+  const auto halve = [&m](T &x) {
+    // (x + m) / 2 for odd x, without overflowing past m
+    x = (x.tail() & 1) ? (x >> 1) + (m >> 1) + T(1) : x >> 1;
+  };
+  while (u && u != T(1) && v != T(1)) {
+    while (!(u.tail() & 1)) {
+      u >>= 1;
+      halve(x1);
+    }
+    while (!(v.tail() & 1)) {
+      v >>= 1;
+      halve(x2);
     }
+    if (u >= v) {
+      u -= v;
+      x1 = x1 >= x2 ? x1 - x2 : x1 + (m - x2);
+    } else {
+      v -= u;
+      x2 = x2 >= x1 ? x2 - x1 : x2 + (m - x1);
+    }
+  }
+  if (u == T(1)) {
+    return x1;
+  }
+  if (v == T(1)) {
+    return x2;
+  }
+  throw std::domain_error("Value is not invertible");
+}
 
-    result *= ten;
-    result += T(static_cast<int>(c - '0'));
+namespace detail {
+// Bitwise select: a where mask is all ones, b where it is zero
+template <size_t Bits>
+constexpr FixedInteger<Bits> select(uint64_t mask, const FixedInteger<Bits> &a,
+                                    const FixedInteger<Bits> &b) {
+  FixedInteger<Bits> result;
+  for (size_t i = 0; i < result.as_span().size(); ++i) {
+    result.as_span()[i] = (a.as_span()[i] & mask) | (b.as_span()[i] & ~mask);
   }
+  return result;
+}
+
+// All ones if the two's-complement value is negative, else zero
+template <size_t Bits>
+constexpr uint64_t sign_mask(const FixedInteger<Bits> &value) {
+  return 0 - (value.as_span().back() >> 63);
+}
+
+// 62 Bernstein-Yang divsteps on the low limbs of f and g, branch-free.
+// Returns the transition matrix (u, v, q, r), scaled by 2^62, such that
+// f' = (u f + v g) / 2^62 and g' = (q f + r g) / 2^62.
+constexpr std::array<uint64_t, 4> divsteps_62(int64_t &delta, uint64_t f,
+                                              uint64_t g) {
+  uint64_t u = 1, v = 0, q = 0, r = 1;
+  for (int i = 0; i < 62; ++i) {
+    const uint64_t odd = 0 - (g & 1);
+    const uint64_t swap = odd & static_cast<uint64_t>((-delta) >> 63);
+
+    // If delta > 0 and g is odd: (delta, f, g) = (-delta, g, -f)
+    const uint64_t old_f = f, old_u = u, old_v = v;
+    f = (g & swap) | (f & ~swap);
+    g = ((0 - old_f) & swap) | (g & ~swap);
+    u = (q & swap) | (u & ~swap);
+    q = ((0 - old_u) & swap) | (q & ~swap);
+    v = (r & swap) | (v & ~swap);
+    r = ((0 - old_v) & swap) | (r & ~swap);
+    delta = (delta ^ static_cast<int64_t>(swap)) - static_cast<int64_t>(swap);
+
+    // (delta, g) = (1 + delta, (g + [g odd] f) / 2); halving g scales the
+    // f row up instead
+    ++delta;
+    g = (g + (f & odd)) >> 1;
+    q += u & odd;
+    r += v & odd;
+    u <<= 1;
+    v <<= 1;
+  }
+  return {u, v, q, r};
+}
 
+// A signed 64-bit value sign-extended to Bits, without the branch in the
+// integral constructor
+template <size_t Bits>
+constexpr FixedInteger<Bits> sign_extend(uint64_t value) {
+  FixedInteger<Bits> result;
+  auto limbs = result.as_span();
+  limbs[0] = value;
+  std::fill(limbs.begin() + 1, limbs.end(), 0 - (value >> 63));
   return result;
 }
 
+// Arithmetic shift right
+template <size_t Bits>
+constexpr FixedInteger<Bits> signed_shift_right(const FixedInteger<Bits> &value,
+                                                size_t shift) {
+  return (value >> shift) |
+         select(sign_mask(value), ~(~FixedInteger<Bits>(0) >> shift),
+                FixedInteger<Bits>(0));
+}
+} // namespace detail
+
+// a^-1 mod m for odd m and a < m in time independent of a (Bernstein-Yang
+// safegcd): a fixed number of divsteps, 62 at a time on the low limbs,
+// with each batch's transition matrix applied to the full values. f and g
+// are signed and twice as wide as the inputs; the cofactors d and e stay
+// in [0, m). Matrix entries are sign-extended and the result's sign is
+// fixed with masks, so only the final invertibility check branches.
+template <size_t Bits>
+constexpr FixedInteger<Bits>
+modinv_constant_time(const FixedInteger<Bits> &a, const FixedInteger<Bits> &m) {
+  using Wide = FixedInteger<2 * Bits>;
+  if (!(m.tail() & 1)) {
+    throw std::domain_error("Modulus must be odd");
+  }
+  trace::Scope scope("modinv", "safegcd", a.length(), m.length());
+  const Wide modulus = detail::resize_fixed<2 * Bits>(m);
+  constexpr uint64_t low_62 = (uint64_t(1) << 62) - 1;
+  const uint64_t m_inverse = detail::limb_inverse(m.tail()) & low_62;
+
+  // (x d + y e) / 2^62 mod m for signed matrix entries x and y: adding a
+  // multiple of m clears the low 62 bits, then the result is brought back
+  // into [0, m)
+  const auto combine = [&](uint64_t x, const Wide &d, uint64_t y,
+                           const Wide &e) {
+    constexpr auto entry = detail::sign_extend<2 * Bits>;
+    Wide t = entry(x) * d + entry(y) * e;
+    const uint64_t k = (0 - t.tail() * m_inverse) & low_62;
+    t = detail::signed_shift_right(t + Wide(k) * modulus, 62);
+    for (int i = 0; i < 3; ++i) {
+      t += detail::select(detail::sign_mask(t), modulus, Wide(0));
+    }
+    for (int i = 0; i < 2; ++i) {
+      const Wide reduced = t - modulus;
+      t = detail::select(detail::sign_mask(reduced), t, reduced);
+    }
+    return t;
+  };
+
+  // f = d a and g = e a (mod m) throughout
+  Wide f = modulus;
+  Wide g = detail::resize_fixed<2 * Bits>(a);
+  Wide d(0);
+  Wide e(1);
+  int64_t delta = 1;
+  // Enough divsteps for any inputs below 2^Bits (Bernstein-Yang, thm. 11.2)
+  const size_t steps = (49 * Bits + 80) / 17;
+  for (size_t i = 0; i < steps; i += 62) {
+    const auto [u, v, q, r] = detail::divsteps_62(delta, f.tail(), g.tail());
+    constexpr auto entry = detail::sign_extend<2 * Bits>;
+    const Wide next_f =
+        detail::signed_shift_right(entry(u) * f + entry(v) * g, 62);
+    g = detail::signed_shift_right(entry(q) * f + entry(r) * g, 62);
+    f = next_f;
+    const Wide next_d = combine(u, d, v, e);
+    e = combine(q, d, r, e);
+    d = next_d;
+  }
+
+  if (f != Wide(1) && f != Wide(0) - Wide(1)) {
+    throw std::domain_error("Value is not invertible");
+  }
+  // f = -1 negates the inverse: m - d, which is m itself only for d = 0
+  Wide result = detail::select(detail::sign_mask(f), modulus - d, d);
+  const Wide reduced = result - modulus;
+  result = detail::select(detail::sign_mask(reduced), result, reduced);
+  return detail::resize_fixed<Bits>(result);
+}
+
+// Jacobi symbol (a / n) for odd n by the binary algorithm: factors of two
+// and reciprocity flips instead of divisions. For prime n this is the
+// Legendre symbol, 1 for quadratic residues and -1 otherwise.
+template <Integer T> constexpr int jacobi(T a, T n) {
+  if (!(n.tail() & 1)) {
+    throw std::domain_error("Jacobi symbol needs an odd modulus");
+  }
+  trace::Scope scope("jacobi", "binary", a.length(), n.length());
+  // Subtraction alone would take too long for a much wider than n
+  if (bit_width(a) > bit_width(n)) {
+    a %= n;
+  }
+
+  int result = 1;
+  while (a) {
+    const size_t twos = trailing_zeros(a);
+    a >>= twos;
+    // (2 / n) = -1 for n = 3, 5 (mod 8)
+    if ((twos & 1) && ((n.tail() & 7) == 3 || (n.tail() & 7) == 5)) {
+      result = -result;
+    }
+    if (a < n) {
+      std::swap(a, n);
+      if ((a.tail() & 3) == 3 && (n.tail() & 3) == 3) {
+        result = -result;
+      }
+    }
+    a -= n;
+  }
+  return n == T(1) ? result : 0;
+}
+
+namespace detail {
+// limbs /= d in place for odd d dividing them exactly, from the low limb
+// up: each quotient limb is the running remainder times d^-1 mod 2^64
+constexpr void divexact_limbs_1(std::span<uint64_t> limbs, uint64_t d) {
+  const uint64_t inverse = limb_inverse(d);
+  uint64_t borrow = 0;
+  for (auto &limb : limbs) {
+    const uint64_t carry = limb < borrow;
+    limb = (limb - borrow) * inverse;
+    borrow = mul_high(limb, d) + carry;
+  }
+}
+
+// limbs /= d in place for odd d dividing them exactly, modulo
+// 2^(64 limbs.size()). Each quotient limb clears one low limb of the
+// remainder, and limbs at or above limbs.size() are never read again, so
+// every row of products stops there.
+constexpr void divexact_limbs(std::span<uint64_t> limbs,
+                              std::span<const uint64_t> d) {
+  const uint64_t inverse = limb_inverse(d[0]);
+  for (size_t i = 0; i < limbs.size(); ++i) {
+    const uint64_t q = limbs[i] * inverse;
+    // q d[0] cancels limbs[i] exactly, leaving only its high half
+    uint64_t borrow = mul_high(q, d[0]);
+    for (size_t j = 1; j < d.size() && i + j < limbs.size(); ++j) {
+      const uint64_t low = q * d[j];
+      const uint64_t product = low + borrow;
+      borrow = mul_high(q, d[j]) + (product < low);
+      const uint64_t limb = limbs[i + j];
+      limbs[i + j] = limb - product;
+      borrow += limb < product;
+    }
+    for (size_t j = i + d.size(); borrow && j < limbs.size(); ++j) {
+      const uint64_t limb = limbs[j];
+      limbs[j] = limb - borrow;
+      borrow = limb < borrow;
+    }
+    limbs[i] = q;
+  }
+}
+
+// Number of limbs up to the highest nonzero one
+constexpr size_t significant_limbs(const Integer auto &value) {
+  return (bit_width(value) + 63) / 64;
+}
+} // namespace detail
+
+// a / d for a limb d that is known to divide a exactly, with one multiply
+// per limb instead of a division. The result is meaningless when d does
+// not divide a.
+template <Integer T> constexpr T divexact_1(const T &a, uint64_t d) {
+  if (!d) {
+    throw std::domain_error("Division by zero");
+  }
+  trace::Scope scope("divide", "exact", a.length(), 1);
+  const int shift = std::countr_zero(d);
+  T result = a >> shift;
+  auto limbs = result.as_span().first(detail::significant_limbs(result));
+  detail::divexact_limbs_1(limbs, d >> shift);
+  if constexpr (T::is_dynamic) {
+    return T(std::span<const uint64_t>(limbs));
+  } else {
+    return result;
+  }
+}
+
+// a / b for b known to divide a exactly (Jebelean's exact division): the
+// quotient is built from the low limb up against the 2-adic inverse of b,
+// reading only as many limbs of a as the quotient has. Much cheaper than
+// operator/ when the remainder is known to be zero, as when dividing out a
+// gcd; the result is meaningless when b does not divide a.
+template <Integer T> constexpr T divexact(const T &a, const T &b) {
+  if (!b) {
+    throw std::domain_error("Division by zero");
+  }
+  const size_t shift = trailing_zeros(b);
+  const T divisor = b >> shift;
+  const auto d = divisor.as_span().first(detail::significant_limbs(divisor));
+  if (d.size() == 1) {
+    return divexact_1(a >> shift, d[0]);
+  }
+  trace::Scope scope("divide", "exact", a.length(), b.length());
+
+  T result = a >> shift;
+  const size_t limbs = detail::significant_limbs(result);
+  if (limbs < d.size()) {
+    return T(0);
+  }
+  // The quotient has at most limbs - d.size() + 1 limbs; clear the rest
+  auto span = result.as_span();
+  const size_t quotient_limbs = limbs - d.size() + 1;
+  detail::divexact_limbs(span.first(quotient_limbs), d);
+  std::fill(span.begin() + quotient_limbs, span.end(), 0);
+  if constexpr (T::is_dynamic) {
+    return T(std::span<const uint64_t>(span));
+  } else {
+    return result;
+  }
+}
+
 } // namespace ArbitraryPrecision
 
 // std::numeric_limits specialization
@@ -978,4 +1867,19 @@ public:
 
   static constexpr Integer max() noexcept { return ~Integer(0); }
 };
+
+// std::hash specializations
+template <size_t Bits> struct hash<ArbitraryPrecision::FixedInteger<Bits>> {
+  constexpr size_t
+  operator()(const ArbitraryPrecision::FixedInteger<Bits> &value) const {
+    return ArbitraryPrecision::detail::hash_limbs(value.as_span());
+  }
+};
+
+template <> struct hash<ArbitraryPrecision::DynamicInteger> {
+  constexpr size_t
+  operator()(const ArbitraryPrecision::DynamicInteger &value) const {
+    return ArbitraryPrecision::detail::hash_limbs(value.as_span());
+  }
+};
 } // namespace std
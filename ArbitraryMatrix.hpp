@@ -0,0 +1,257 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+// Tile edge, in elements, of the blocked multiplication kernel
+inline constexpr size_t matrix_block = 32;
+
+// Square FixedInteger products from this size up recurse with Strassen
+inline constexpr size_t strassen_threshold = 64;
+
+// Element products below this count are not worth a thread
+inline constexpr size_t parallel_matrix_threshold = size_t(1) << 15;
+
+// acc += a * b, fused where the type supports it
+template <Integer T> void add_product(T &acc, const T &a, const T &b) {
+  if constexpr (std::same_as<T, DynamicInteger>) {
+    acc.add_product(a, b);
+  } else {
+    acc += a * b;
+  }
+}
+} // namespace detail
+
+// Dense row-major matrix of FixedInteger or DynamicInteger values.
+// Subtraction wraps modulo 2^Bits and so is only offered for FixedInteger.
+template <Integer T> class Matrix {
+public:
+  Matrix() = default;
+
+  // rows x cols zero matrix
+  Matrix(size_t rows, size_t cols)
+      : rows_(rows), cols_(cols), values_(rows * cols) {}
+
+  static Matrix identity(size_t n) {
+    Matrix result(n, n);
+    for (size_t i = 0; i < n; ++i) {
+      result(i, i) = T(1);
+    }
+    return result;
+  }
+
+  size_t rows() const { return rows_; }
+  size_t cols() const { return cols_; }
+
+  T &operator()(size_t row, size_t col) { return values_[row * cols_ + col]; }
+  const T &operator()(size_t row, size_t col) const {
+    return values_[row * cols_ + col];
+  }
+
+  std::span<const T> row(size_t index) const {
+    return std::span<const T>(values_).subspan(index * cols_, cols_);
+  }
+
+  Matrix &operator+=(const Matrix &other) {
+    check_same_shape(other);
+    for (size_t i = 0; i < values_.size(); ++i) {
+      values_[i] += other.values_[i];
+    }
+    return *this;
+  }
+
+  Matrix &operator-=(const Matrix &other)
+    requires detail::instantiation_of_nontype<T, FixedInteger>
+  {
+    check_same_shape(other);
+    for (size_t i = 0; i < values_.size(); ++i) {
+      values_[i] -= other.values_[i];
+    }
+    return *this;
+  }
+
+  Matrix operator+(const Matrix &other) const {
+    Matrix result = *this;
+    return result += other;
+  }
+
+  Matrix operator-(const Matrix &other) const
+    requires detail::instantiation_of_nontype<T, FixedInteger>
+  {
+    Matrix result = *this;
+    return result -= other;
+  }
+
+  Matrix operator*(const Matrix &other) const;
+
+  bool operator==(const Matrix &other) const = default;
+
+private:
+  size_t rows_ = 0;
+  size_t cols_ = 0;
+  std::vector<T> values_;
+
+  void check_same_shape(const Matrix &other) const {
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+      throw std::domain_error("Matrix shapes do not match");
+    }
+  }
+};
+
+namespace detail {
+// c[begin, end) += a[begin, end) * b, one cache tile of a and b at a time;
+// the i-k-j order walks rows of b and c contiguously
+template <Integer T>
+void addmul_rows(Matrix<T> &c, const Matrix<T> &a, const Matrix<T> &b,
+                 size_t begin, size_t end) {
+  const size_t inner = a.cols();
+  const size_t cols = b.cols();
+  for (size_t kk = 0; kk < inner; kk += matrix_block) {
+    const size_t k_end = std::min(kk + matrix_block, inner);
+    for (size_t jj = 0; jj < cols; jj += matrix_block) {
+      const size_t j_end = std::min(jj + matrix_block, cols);
+      for (size_t i = begin; i < end; ++i) {
+        for (size_t k = kk; k < k_end; ++k) {
+          const T &lhs = a(i, k);
+          if (!lhs) {
+            continue;
+          }
+          for (size_t j = jj; j < j_end; ++j) {
+            add_product(c(i, j), lhs, b(k, j));
+          }
+        }
+      }
+    }
+  }
+}
+
+// Blocked kernel with the rows of c split across up to `threads` workers;
+// each worker owns a disjoint row range, so no synchronization is needed
+template <Integer T>
+void addmul_blocked(Matrix<T> &c, const Matrix<T> &a, const Matrix<T> &b,
+                    size_t threads) {
+  const size_t work = a.rows() * a.cols() * b.cols();
+  threads = std::min(threads, a.rows());
+  if (threads <= 1 || work < parallel_matrix_threshold) {
+    addmul_rows(c, a, b, 0, a.rows());
+    return;
+  }
+
+  const size_t chunk = (a.rows() + threads - 1) / threads;
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_t begin = chunk; begin < a.rows(); begin += chunk) {
+    const size_t end = std::min(begin + chunk, a.rows());
+    workers.emplace_back(addmul_rows<T>, std::ref(c), std::cref(a),
+                         std::cref(b), begin, end);
+  }
+  addmul_rows(c, a, b, 0, std::min(chunk, a.rows()));
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+// The size x size block of m at (row, col), zero past m's edges
+template <Integer T>
+Matrix<T> quadrant(const Matrix<T> &m, size_t row, size_t col, size_t size) {
+  Matrix<T> result(size, size);
+  for (size_t i = row; i < std::min(row + size, m.rows()); ++i) {
+    for (size_t j = col; j < std::min(col + size, m.cols()); ++j) {
+      result(i - row, j - col) = m(i, j);
+    }
+  }
+  return result;
+}
+
+// Strassen's seven-product recursion for square n x n operands; odd sizes
+// are padded with a zero row and column at each level
+template <size_t Bits>
+Matrix<FixedInteger<Bits>> strassen(const Matrix<FixedInteger<Bits>> &a,
+                                    const Matrix<FixedInteger<Bits>> &b,
+                                    size_t threads) {
+  const size_t n = a.rows();
+  if (n < strassen_threshold) {
+    Matrix<FixedInteger<Bits>> result(n, n);
+    addmul_blocked(result, a, b, threads);
+    return result;
+  }
+  trace::Scope scope("matrix", "strassen", n, n);
+
+  const size_t h = (n + 1) / 2;
+  const auto a11 = quadrant(a, 0, 0, h), a12 = quadrant(a, 0, h, h);
+  const auto a21 = quadrant(a, h, 0, h), a22 = quadrant(a, h, h, h);
+  const auto b11 = quadrant(b, 0, 0, h), b12 = quadrant(b, 0, h, h);
+  const auto b21 = quadrant(b, h, 0, h), b22 = quadrant(b, h, h, h);
+
+  const auto m1 = strassen(a11 + a22, b11 + b22, threads);
+  const auto m2 = strassen(a21 + a22, b11, threads);
+  const auto m3 = strassen(a11, b12 - b22, threads);
+  const auto m4 = strassen(a22, b21 - b11, threads);
+  const auto m5 = strassen(a11 + a12, b22, threads);
+  const auto m6 = strassen(a21 - a11, b11 + b12, threads);
+  const auto m7 = strassen(a12 - a22, b21 + b22, threads);
+
+  const auto c11 = m1 + m4 - m5 + m7;
+  const auto c12 = m3 + m5;
+  const auto c21 = m2 + m4;
+  const auto c22 = m1 - m2 + m3 + m6;
+
+  Matrix<FixedInteger<Bits>> result(n, n);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      const auto &block = i < h ? (j < h ? c11 : c12) : (j < h ? c21 : c22);
+      result(i, j) = block(i % h, j % h);
+    }
+  }
+  return result;
+}
+
+template <Integer T>
+bool use_strassen(const Matrix<T> &a, const Matrix<T> &b) {
+  return instantiation_of_nontype<T, FixedInteger> && a.rows() == a.cols() &&
+         b.rows() == b.cols() && a.rows() == b.rows() &&
+         a.rows() >= strassen_threshold;
+}
+} // namespace detail
+
+// c += a * b. DynamicInteger elements accumulate in place with no
+// per-element temporaries; large square FixedInteger operands go through
+// Strassen. Rows of c are split across `threads` workers.
+template <Integer T>
+void addmul(Matrix<T> &c, const Matrix<T> &a, const Matrix<T> &b,
+            size_t threads = std::thread::hardware_concurrency()) {
+  if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols()) {
+    throw std::domain_error("Matrix shapes do not match");
+  }
+  if constexpr (detail::instantiation_of_nontype<T, FixedInteger>) {
+    if (detail::use_strassen(a, b)) {
+      c += detail::strassen(a, b, threads);
+      return;
+    }
+  }
+  detail::addmul_blocked(c, a, b, threads);
+}
+
+template <Integer T>
+Matrix<T> multiply(const Matrix<T> &a, const Matrix<T> &b,
+                   size_t threads = std::thread::hardware_concurrency()) {
+  Matrix<T> result(a.rows(), b.cols());
+  addmul(result, a, b, threads);
+  return result;
+}
+
+template <Integer T>
+Matrix<T> Matrix<T>::operator*(const Matrix &other) const {
+  return multiply(*this, other);
+}
+
+} // namespace ArbitraryPrecision
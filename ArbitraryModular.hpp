@@ -0,0 +1,153 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+// a * b mod m through a double-width DynamicInteger product
+template <size_t Bits>
+FixedInteger<Bits> mulmod(const FixedInteger<Bits> &a,
+                          const FixedInteger<Bits> &b,
+                          const FixedInteger<Bits> &m) {
+  return FixedInteger<Bits>(DynamicInteger(a) * DynamicInteger(b) %
+                            DynamicInteger(m));
+}
+} // namespace detail
+
+// Residue modulo a runtime modulus below 2^Bits. Each value carries its
+// modulus; mixing moduli throws std::domain_error. Division needs a divisor
+// coprime to the modulus.
+template <size_t Bits> class ModInt {
+public:
+  using Value = FixedInteger<Bits>;
+
+  // Placeholder without a modulus; assign a real ModInt before use
+  ModInt() = default;
+
+  ModInt(const Value &value, const Value &modulus)
+      : value_(value), modulus_(modulus) {
+    if (!modulus) {
+      throw std::domain_error("Modulus must be nonzero");
+    }
+    if (value_ >= modulus_) {
+      value_ %= modulus_;
+    }
+  }
+
+  ModInt(std::integral auto value, const Value &modulus)
+      : ModInt(Value(0), modulus) {
+    using Unsigned = std::make_unsigned_t<decltype(value)>;
+    Unsigned magnitude = static_cast<Unsigned>(value);
+    bool negative = false;
+    if constexpr (std::is_signed_v<decltype(value)>) {
+      if (value < 0) {
+        negative = true;
+        magnitude = static_cast<Unsigned>(0) - magnitude;
+      }
+    }
+    *this = ModInt(Value(magnitude), modulus);
+    if (negative) {
+      *this = -*this;
+    }
+  }
+
+  const Value &value() const { return value_; }
+  const Value &modulus() const { return modulus_; }
+
+  explicit operator bool() const { return static_cast<bool>(value_); }
+
+  ModInt operator-() const {
+    ModInt result = *this;
+    if (value_) {
+      result.value_ = modulus_ - value_;
+    }
+    return result;
+  }
+
+  ModInt &operator+=(const ModInt &other) {
+    check_modulus(other);
+    const Value sum = value_ + other.value_;
+    value_ = (sum < value_ || sum >= modulus_) ? sum - modulus_ : sum;
+    return *this;
+  }
+
+  ModInt &operator-=(const ModInt &other) {
+    check_modulus(other);
+    // Wraps past 2^Bits and back when value_ < other.value_
+    value_ = value_ >= other.value_ ? value_ - other.value_
+                                    : value_ - other.value_ + modulus_;
+    return *this;
+  }
+
+  ModInt &operator*=(const ModInt &other) {
+    check_modulus(other);
+    value_ = detail::mulmod(value_, other.value_, modulus_);
+    return *this;
+  }
+
+  ModInt &operator/=(const ModInt &other) { return *this *= other.inverse(); }
+
+  ModInt operator+(const ModInt &other) const {
+    ModInt result = *this;
+    return result += other;
+  }
+
+  ModInt operator-(const ModInt &other) const {
+    ModInt result = *this;
+    return result -= other;
+  }
+
+  ModInt operator*(const ModInt &other) const {
+    ModInt result = *this;
+    return result *= other;
+  }
+
+  ModInt operator/(const ModInt &other) const {
+    ModInt result = *this;
+    return result /= other;
+  }
+
+  bool operator==(const ModInt &other) const {
+    return value_ == other.value_ && modulus_ == other.modulus_;
+  }
+
+  // this^exponent by left-to-right square and multiply
+  template <Integer E> ModInt pow(const E &exponent) const {
+    ModInt result(Value(1), modulus_);
+    for (size_t bit = bit_width(exponent); bit > 0; --bit) {
+      result *= result;
+      auto limbs = exponent.as_span();
+      if ((limbs[(bit - 1) / 64] >> ((bit - 1) % 64)) & 1) {
+        result *= *this;
+      }
+    }
+    return result;
+  }
+
+  ModInt inverse() const {
+    if (!value_) {
+      throw std::domain_error("Division by zero");
+    }
+    return ModInt(modinv(value_, modulus_), modulus_);
+  }
+
+private:
+  Value value_;
+  Value modulus_;
+
+  void check_modulus(const ModInt &other) const {
+    if (modulus_ != other.modulus_) {
+      throw std::domain_error("ModInt moduli differ");
+    }
+  }
+};
+
+template <size_t Bits> std::string to_string(const ModInt<Bits> &value) {
+  return to_string(value.value());
+}
+
+} // namespace ArbitraryPrecision
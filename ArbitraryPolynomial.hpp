@@ -0,0 +1,386 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <ArbitraryModular.hpp>
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ArbitraryPrecision {
+
+template <typename T>
+concept ModIntType = detail::instantiation_of_nontype<T, ModInt>;
+
+template <typename T>
+concept PolynomialCoefficient =
+    std::same_as<T, DynamicInteger> || ModIntType<T>;
+
+namespace detail {
+// Writes each coefficient into its own `slot` limbs of one integer
+inline DynamicInteger kronecker_pack(std::span<const DynamicInteger> values,
+                                     size_t slot) {
+  std::vector<uint64_t> limbs(values.size() * slot, 0);
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto source = values[i].as_span();
+    std::copy(source.begin(), source.end(), limbs.begin() + i * slot);
+  }
+  return DynamicInteger(std::span<const uint64_t>(limbs));
+}
+
+inline std::vector<DynamicInteger>
+kronecker_unpack(const DynamicInteger &packed, size_t slot, size_t count) {
+  auto limbs = packed.as_span();
+  std::vector<DynamicInteger> values(count);
+  for (size_t i = 0; i < count && i * slot < limbs.size(); ++i) {
+    values[i] = DynamicInteger(
+        limbs.subspan(i * slot, std::min(slot, limbs.size() - i * slot)));
+  }
+  return values;
+}
+
+// Kronecker substitution: evaluates both polynomials at x = 2^(64 slot),
+// where a slot is wide enough to hold any product coefficient, so the whole
+// product is a single big integer multiplication
+inline std::vector<DynamicInteger>
+kronecker_multiply(std::span<const DynamicInteger> a,
+                   std::span<const DynamicInteger> b) {
+  size_t a_bits = 0;
+  size_t b_bits = 0;
+  for (const auto &value : a) {
+    a_bits = std::max(a_bits, bit_width(value));
+  }
+  for (const auto &value : b) {
+    b_bits = std::max(b_bits, bit_width(value));
+  }
+  const size_t bits =
+      a_bits + b_bits +
+      static_cast<size_t>(std::bit_width(std::min(a.size(), b.size())));
+  const size_t slot = std::max<size_t>(1, (bits + 63) / 64);
+
+  return kronecker_unpack(kronecker_pack(a, slot) * kronecker_pack(b, slot),
+                          slot, a.size() + b.size() - 1);
+}
+
+// k as a coefficient compatible with `like`
+template <PolynomialCoefficient T> T coefficient(const T &like, uint64_t k) {
+  if constexpr (ModIntType<T>) {
+    return T(k, like.modulus());
+  } else {
+    return T(k);
+  }
+}
+} // namespace detail
+
+// Dense polynomial, lowest degree first, over DynamicInteger (nonnegative
+// coefficients) or a prime field ModInt<Bits>. Products use Kronecker
+// substitution. Over a field, multipoint evaluation and interpolation go
+// through a subproduct tree of (x - x_i), whose remainders come from a
+// Newton series inverse rather than long division; over DynamicInteger,
+// where x - x_i has no representation, evaluation falls back to Horner per
+// point.
+template <PolynomialCoefficient T> class Polynomial {
+public:
+  Polynomial() = default;
+
+  explicit Polynomial(std::vector<T> coefficients)
+      : coefficients_(std::move(coefficients)) {
+    trim();
+  }
+
+  const std::vector<T> &coefficients() const { return coefficients_; }
+
+  // Number of coefficients, degree + 1 (0 for the zero polynomial)
+  size_t size() const { return coefficients_.size(); }
+
+  const T &operator[](size_t index) const { return coefficients_[index]; }
+
+  explicit operator bool() const { return !coefficients_.empty(); }
+
+  Polynomial &operator+=(const Polynomial &other) {
+    const size_t common = std::min(size(), other.size());
+    for (size_t i = 0; i < common; ++i) {
+      coefficients_[i] += other.coefficients_[i];
+    }
+    coefficients_.insert(coefficients_.end(),
+                         other.coefficients_.begin() +
+                             static_cast<std::ptrdiff_t>(common),
+                         other.coefficients_.end());
+    trim();
+    return *this;
+  }
+
+  Polynomial &operator-=(const Polynomial &other)
+    requires ModIntType<T>
+  {
+    return *this += -other;
+  }
+
+  Polynomial operator-() const
+    requires ModIntType<T>
+  {
+    Polynomial result = *this;
+    for (auto &c : result.coefficients_) {
+      c = -c;
+    }
+    return result;
+  }
+
+  Polynomial &operator*=(const Polynomial &other) {
+    return *this = *this * other;
+  }
+
+  Polynomial operator+(const Polynomial &other) const {
+    Polynomial result = *this;
+    return result += other;
+  }
+
+  Polynomial operator-(const Polynomial &other) const
+    requires ModIntType<T>
+  {
+    Polynomial result = *this;
+    return result -= other;
+  }
+
+  Polynomial operator*(const Polynomial &other) const {
+    if (!*this || !other) {
+      return Polynomial();
+    }
+    if constexpr (ModIntType<T>) {
+      const auto &modulus = coefficients_.front().modulus();
+      if (other.coefficients_.front().modulus() != modulus) {
+        throw std::domain_error("Polynomial moduli differ");
+      }
+      auto product = detail::kronecker_multiply(lift(*this), lift(other));
+      const DynamicInteger wide_modulus(modulus);
+      std::vector<T> result;
+      result.reserve(product.size());
+      for (auto &value : product) {
+        result.emplace_back(typename T::Value(value % wide_modulus), modulus);
+      }
+      return Polynomial(std::move(result));
+    } else {
+      return Polynomial(
+          detail::kronecker_multiply(coefficients_, other.coefficients_));
+    }
+  }
+
+  bool operator==(const Polynomial &other) const = default;
+
+  // Horner evaluation at one point
+  T operator()(const T &x) const {
+    if (!*this) {
+      return x - x;
+    }
+    T result = coefficients_.back();
+    for (size_t i = size() - 1; i > 0; --i) {
+      result *= x;
+      result += coefficients_[i - 1];
+    }
+    return result;
+  }
+
+  Polynomial derivative() const {
+    std::vector<T> result;
+    for (size_t i = 1; i < size(); ++i) {
+      result.push_back(coefficients_[i] *
+                       detail::coefficient(coefficients_[i], i));
+    }
+    return Polynomial(std::move(result));
+  }
+
+  // Values at every point
+  std::vector<T> evaluate(std::span<const T> points) const {
+    if constexpr (ModIntType<T>) {
+      if (points.empty()) {
+        return {};
+      }
+      return evaluate(SubproductTree(points));
+    } else {
+      std::vector<T> values;
+      values.reserve(points.size());
+      for (const auto &x : points) {
+        values.push_back((*this)(x));
+      }
+      return values;
+    }
+  }
+
+  // The unique polynomial of degree < n through (xs[i], ys[i]); the xs
+  // must be distinct
+  static Polynomial interpolate(std::span<const T> xs, std::span<const T> ys)
+    requires ModIntType<T>
+  {
+    if (xs.size() != ys.size()) {
+      throw std::domain_error("Point and value counts differ");
+    }
+    if (xs.empty()) {
+      return Polynomial();
+    }
+    const SubproductTree tree(xs);
+    // Lagrange weights are y_i / M'(x_i) with M = prod (x - x_j)
+    const auto weights = tree.root().derivative().evaluate(tree);
+
+    std::vector<Polynomial> sums;
+    for (size_t i = 0; i < xs.size(); ++i) {
+      sums.push_back(Polynomial({ys[i] / weights[i]}));
+    }
+    // Up the tree: parent = left_sum * right_node + right_sum * left_node
+    for (size_t level = 0; level + 1 < tree.levels.size(); ++level) {
+      const auto &nodes = tree.levels[level];
+      std::vector<Polynomial> above;
+      for (size_t i = 0; i < sums.size(); i += 2) {
+        above.push_back(i + 1 < sums.size()
+                            ? sums[i] * nodes[i + 1] + sums[i + 1] * nodes[i]
+                            : sums[i]);
+      }
+      sums = std::move(above);
+    }
+    return sums.front();
+  }
+
+private:
+  std::vector<T> coefficients_;
+
+  void trim() {
+    while (!coefficients_.empty() && !coefficients_.back()) {
+      coefficients_.pop_back();
+    }
+  }
+
+  static std::vector<DynamicInteger> lift(const Polynomial &polynomial) {
+    std::vector<DynamicInteger> values;
+    values.reserve(polynomial.size());
+    for (const auto &c : polynomial.coefficients_) {
+      values.emplace_back(c.value());
+    }
+    return values;
+  }
+
+  // Products of (x - x_i) over a balanced binary tree; levels[0] holds the
+  // linear leaves and levels.back() the single root
+  struct SubproductTree {
+    std::vector<std::vector<Polynomial>> levels;
+
+    explicit SubproductTree(std::span<const T> points) {
+      std::vector<Polynomial> leaves;
+      for (const auto &x : points) {
+        leaves.push_back(Polynomial({-x, detail::coefficient(x, 1)}));
+      }
+      levels.push_back(std::move(leaves));
+      while (levels.back().size() > 1) {
+        const auto &below = levels.back();
+        std::vector<Polynomial> above;
+        for (size_t i = 0; i < below.size(); i += 2) {
+          above.push_back(i + 1 < below.size() ? below[i] * below[i + 1]
+                                               : below[i]);
+        }
+        levels.push_back(std::move(above));
+      }
+    }
+
+    const Polynomial &root() const { return levels.back().front(); }
+  };
+
+  // Coefficients below x^count
+  Polynomial truncated(size_t count) const {
+    if (size() <= count) {
+      return *this;
+    }
+    return Polynomial(std::vector<T>(
+        coefficients_.begin(),
+        coefficients_.begin() + static_cast<std::ptrdiff_t>(count)));
+  }
+
+  // x^(count - 1) p(1/x) for count >= size(), zero-padded at the low end
+  Polynomial reversed(size_t count) const {
+    std::vector<T> result(count - size(),
+                          detail::coefficient(coefficients_.front(), 0));
+    result.insert(result.end(), coefficients_.rbegin(), coefficients_.rend());
+    return Polynomial(std::move(result));
+  }
+
+  // h with h p = 1 mod x^count, for p(0) = 1, by Newton iteration:
+  // h <- h + h (1 - p h), doubling the correct low coefficients each step
+  Polynomial inverse_series(size_t count) const {
+    const Polynomial one({detail::coefficient(coefficients_.front(), 1)});
+    Polynomial h = one;
+    for (size_t precision = 1; precision < count;) {
+      precision = std::min(2 * precision, count);
+      const Polynomial error =
+          one - (truncated(precision) * h).truncated(precision);
+      h = (h + (h * error).truncated(precision)).truncated(precision);
+    }
+    return h;
+  }
+
+  // Below this many quotient or divisor coefficients, long division wins
+  static constexpr size_t fast_remainder_threshold = 16;
+
+  // Remainder modulo a monic polynomial. The quotient's coefficients are
+  // those of rev(dividend) / rev(divisor) mod x^count, with the series
+  // inverse by Newton iteration, so both steps are Kronecker products
+  static Polynomial remainder_monic(Polynomial dividend,
+                                    const Polynomial &divisor) {
+    const size_t n = divisor.size();
+    if (dividend.size() < n) {
+      return dividend;
+    }
+    const size_t count = dividend.size() - n + 1;
+    if (count < fast_remainder_threshold || n < fast_remainder_threshold) {
+      return remainder_schoolbook(std::move(dividend), divisor);
+    }
+    const Polynomial quotient =
+        (dividend.reversed(dividend.size()).truncated(count) *
+         divisor.reversed(n).inverse_series(count))
+            .truncated(count)
+            .reversed(count);
+    return (dividend - quotient * divisor).truncated(n - 1);
+  }
+
+  // Remainder modulo a monic polynomial by schoolbook long division
+  static Polynomial remainder_schoolbook(Polynomial dividend,
+                                         const Polynomial &divisor) {
+    const size_t n = divisor.size();
+    auto &c = dividend.coefficients_;
+    for (size_t i = c.size(); i >= n; --i) {
+      const T lead = c[i - 1];
+      if (lead) {
+        for (size_t j = 0; j + 1 < n; ++j) {
+          c[i - n + j] -= lead * divisor.coefficients_[j];
+        }
+      }
+      c.pop_back();
+    }
+    dividend.trim();
+    return dividend;
+  }
+
+  // Remainder tree: f mod each node, from the root down to the leaves
+  std::vector<T> evaluate(const SubproductTree &tree) const {
+    std::vector<Polynomial> remainders{remainder_monic(*this, tree.root())};
+    for (size_t level = tree.levels.size() - 1; level > 0; --level) {
+      const auto &children = tree.levels[level - 1];
+      std::vector<Polynomial> below;
+      for (size_t i = 0; i < remainders.size(); ++i) {
+        below.push_back(remainder_monic(remainders[i], children[2 * i]));
+        if (2 * i + 1 < children.size()) {
+          below.push_back(remainder_monic(remainders[i], children[2 * i + 1]));
+        }
+      }
+      remainders = std::move(below);
+    }
+
+    std::vector<T> values;
+    const auto &leaves = tree.levels.front();
+    for (size_t i = 0; i < remainders.size(); ++i) {
+      values.push_back(remainders[i] ? remainders[i][0]
+                                     : leaves[i][0] - leaves[i][0]);
+    }
+    return values;
+  }
+};
+
+} // namespace ArbitraryPrecision
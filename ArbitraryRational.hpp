@@ -0,0 +1,247 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <compare>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ArbitraryPrecision {
+
+// Exact rational number: a sign and a DynamicInteger numerator/denominator.
+// Reducing by the gcd after every operation dominates the cost of rational
+// arithmetic, so results are left unreduced until the operands have roughly
+// doubled in size since the last reduction (or normalize() is called).
+// Comparisons cross-multiply and never need a reduced form, and values with
+// denominator one take integer-only paths.
+class Rational {
+public:
+  // Limbs of growth tolerated on top of doubling before reducing
+  static constexpr size_t normalize_slack = 4;
+
+  Rational() : den(1) {}
+
+  explicit Rational(std::integral auto value) : den(1) {
+    using Unsigned = std::make_unsigned_t<decltype(value)>;
+    Unsigned magnitude = static_cast<Unsigned>(value);
+    if constexpr (std::is_signed_v<decltype(value)>) {
+      if (value < 0) {
+        negative = true;
+        magnitude = static_cast<Unsigned>(0) - magnitude;
+      }
+    }
+    num = DynamicInteger(magnitude);
+  }
+
+  // numerator / denominator, negated if `negative`
+  Rational(DynamicInteger numerator, DynamicInteger denominator,
+           bool negative = false)
+      : num(std::move(numerator)), den(std::move(denominator)),
+        negative(negative) {
+    if (!den) {
+      throw std::domain_error("Division by zero");
+    }
+    fix_zero();
+    normalize();
+  }
+
+  explicit Rational(DynamicInteger value, bool negative = false)
+      : num(std::move(value)), den(1), negative(negative) {
+    fix_zero();
+  }
+
+  // Current representation, not necessarily in lowest terms
+  const DynamicInteger &numerator() const { return num; }
+  const DynamicInteger &denominator() const { return den; }
+  bool is_negative() const { return negative; }
+  bool is_integer() const { return den == one(); }
+
+  // Divides out the gcd of numerator and denominator
+  Rational &normalize() {
+    if (!is_integer()) {
+      DynamicInteger divisor = gcd(num, den);
+      if (divisor != one()) {
+        num = divexact(num, divisor);
+        den = divexact(den, divisor);
+      }
+    }
+    reduced_limbs = size();
+    return *this;
+  }
+
+  Rational operator+() const { return *this; }
+
+  Rational operator-() const {
+    Rational result = *this;
+    result.negative = !negative && num;
+    return result;
+  }
+
+  Rational &operator+=(const Rational &other) {
+    add(other, other.negative);
+    return *this;
+  }
+
+  Rational &operator-=(const Rational &other) {
+    add(other, !other.negative);
+    return *this;
+  }
+
+  Rational &operator*=(const Rational &other) {
+    if (this == &other) {
+      return *this *= Rational(other);
+    }
+    num *= other.num;
+    if (!other.is_integer()) {
+      den *= other.den;
+    }
+    negative = negative != other.negative;
+    finish();
+    return *this;
+  }
+
+  Rational &operator/=(const Rational &other) {
+    if (!other.num) {
+      throw std::domain_error("Division by zero");
+    }
+    if (this == &other) {
+      return *this = Rational(1);
+    }
+    if (!other.is_integer()) {
+      num *= other.den;
+    }
+    den *= other.num;
+    negative = negative != other.negative;
+    finish();
+    return *this;
+  }
+
+  Rational operator+(const Rational &other) const {
+    Rational result = *this;
+    return result += other;
+  }
+
+  Rational operator-(const Rational &other) const {
+    Rational result = *this;
+    return result -= other;
+  }
+
+  Rational operator*(const Rational &other) const {
+    Rational result = *this;
+    return result *= other;
+  }
+
+  Rational operator/(const Rational &other) const {
+    Rational result = *this;
+    return result /= other;
+  }
+
+  // Cross-multiplied comparison, valid for unreduced representations
+  std::strong_ordering operator<=>(const Rational &other) const {
+    if (negative != other.negative) {
+      return negative ? std::strong_ordering::less
+                      : std::strong_ordering::greater;
+    }
+    std::strong_ordering magnitude = compare_magnitude(other);
+    return negative ? 0 <=> magnitude : magnitude;
+  }
+
+  bool operator==(const Rational &other) const {
+    return negative == other.negative &&
+           compare_magnitude(other) == std::strong_ordering::equal;
+  }
+
+  explicit operator bool() const { return static_cast<bool>(num); }
+
+  // Integer part, rounded toward zero
+  DynamicInteger truncate() const { return is_integer() ? num : num / den; }
+
+private:
+  DynamicInteger num;
+  DynamicInteger den;
+  bool negative = false;
+  // size() when last reduced
+  size_t reduced_limbs = 2;
+
+  static const DynamicInteger &one() {
+    static const DynamicInteger value(1);
+    return value;
+  }
+
+  size_t size() const { return num.length() + den.length(); }
+
+  void fix_zero() {
+    if (!num) {
+      negative = false;
+    }
+  }
+
+  void finish() {
+    fix_zero();
+    if (!num) {
+      den = one();
+    }
+    if (size() > 2 * reduced_limbs + normalize_slack) {
+      normalize();
+    }
+  }
+
+  std::strong_ordering compare_magnitude(const Rational &other) const {
+    if (den == other.den) {
+      return num <=> other.num;
+    }
+    DynamicInteger lhs = other.is_integer() ? num : num * other.den;
+    DynamicInteger rhs = is_integer() ? other.num : other.num * den;
+    return lhs <=> rhs;
+  }
+
+  // *this += (other_negative ? -1 : 1) * |other|
+  void add(const Rational &other, bool other_negative) {
+    if (this == &other) {
+      add(Rational(other), other_negative);
+      return;
+    }
+    if (den == other.den) {
+      add_scaled(other.num, other_negative);
+    } else if (other.is_integer()) {
+      add_scaled(other.num * den, other_negative);
+    } else if (is_integer()) {
+      num *= other.den;
+      den = other.den;
+      add_scaled(other.num, other_negative);
+    } else {
+      DynamicInteger scaled = other.num * den;
+      num *= other.den;
+      den *= other.den;
+      add_scaled(scaled, other_negative);
+    }
+    finish();
+  }
+
+  // num += (value_negative ? -1 : 1) * value, both over the current den
+  void add_scaled(const DynamicInteger &value, bool value_negative) {
+    if (negative == value_negative) {
+      num += value;
+    } else if (num >= value) {
+      num -= value;
+    } else {
+      num = value - num;
+      negative = value_negative;
+    }
+  }
+};
+
+inline std::string to_string(const Rational &value) {
+  Rational reduced = value;
+  reduced.normalize();
+  std::string result = reduced.is_negative() ? "-" : "";
+  result += to_string(reduced.numerator());
+  if (!reduced.is_integer()) {
+    result += '/';
+    result += to_string(reduced.denominator());
+  }
+  return result;
+}
+
+} // namespace ArbitraryPrecision
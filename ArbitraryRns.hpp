@@ -0,0 +1,449 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+// Channel arithmetic. RNS moduli are primes below 2^32, so products of two
+// residues fit a single limb and every channel needs only native 64-bit
+// operations. Channels are independent of each other, but each product is
+// reduced with a hardware division, so the loops stay scalar.
+constexpr uint64_t channel_mul(uint64_t a, uint64_t b, uint64_t p) {
+  return (a * b) % p;
+}
+
+constexpr uint64_t channel_pow(uint64_t base, uint64_t exp, uint64_t p) {
+  uint64_t result = 1 % p;
+  base %= p;
+  while (exp) {
+    if (exp & 1)
+      result = channel_mul(result, base, p);
+    base = channel_mul(base, base, p);
+    exp >>= 1;
+  }
+  return result;
+}
+
+// Inverse of a modulo prime p (a must not be a multiple of p)
+constexpr uint64_t channel_inverse(uint64_t a, uint64_t p) {
+  return channel_pow(a, p - 2, p);
+}
+
+// Deterministic Miller-Rabin for 32-bit candidates (bases 2, 7, 61)
+constexpr bool is_prime_u32(uint64_t n) {
+  if (n < 2)
+    return false;
+  for (uint64_t p : {2, 3, 5, 7, 61}) {
+    if (n % p == 0)
+      return n == p;
+  }
+  uint64_t d = n - 1;
+  int s = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    ++s;
+  }
+  for (uint64_t a : {2, 7, 61}) {
+    uint64_t x = channel_pow(a, d, n);
+    if (x == 1 || x == n - 1)
+      continue;
+    bool composite = true;
+    for (int i = 1; i < s && composite; ++i) {
+      x = channel_mul(x, x, n);
+      composite = x != n - 1;
+    }
+    if (composite)
+      return false;
+  }
+  return true;
+}
+
+// The largest `Count` primes below 2^32, after skipping the first `Skip`
+template <size_t Count, size_t Skip = 0>
+constexpr std::array<uint64_t, Count> rns_primes() {
+  std::array<uint64_t, Count> primes{};
+  size_t found = 0;
+  for (uint64_t candidate = 0xFFFFFFFFULL; found < Skip + Count;
+       candidate -= 2) {
+    if (is_prime_u32(candidate)) {
+      if (found >= Skip)
+        primes[found - Skip] = candidate;
+      ++found;
+    }
+  }
+  return primes;
+}
+
+// Constants for CRT reconstruction over a set of moduli p_i with product M:
+// x = sum(xi_i * M_i) - k * M, where M_i = M / p_i,
+// xi_i = x_i * (M_i^-1 mod p_i) mod p_i and k = floor(sum(xi_i / p_i)).
+template <size_t N> struct RnsBase {
+  std::array<uint64_t, N> primes;
+  std::array<uint64_t, N> cofactor_inverse; // (M / p_i)^-1 mod p_i
+  std::array<double, N> reciprocal;         // 1.0 / p_i
+
+  constexpr explicit RnsBase(const std::array<uint64_t, N> &primes)
+      : primes(primes), cofactor_inverse{}, reciprocal{} {
+    for (size_t i = 0; i < N; ++i) {
+      uint64_t cofactor = 1;
+      for (size_t j = 0; j < N; ++j) {
+        if (j != i)
+          cofactor = channel_mul(cofactor, primes[j] % primes[i], primes[i]);
+      }
+      cofactor_inverse[i] = channel_inverse(cofactor, primes[i]);
+      reciprocal[i] = 1.0 / static_cast<double>(primes[i]);
+    }
+  }
+
+  // M / p_i modulo q, and M modulo q, for extending into another base
+  constexpr uint64_t cofactor_mod(size_t i, uint64_t q) const {
+    uint64_t result = 1;
+    for (size_t j = 0; j < N; ++j) {
+      if (j != i)
+        result = channel_mul(result, primes[j] % q, q);
+    }
+    return result;
+  }
+
+  constexpr uint64_t product_mod(uint64_t q) const {
+    uint64_t result = 1;
+    for (uint64_t p : primes) {
+      result = channel_mul(result, p % q, q);
+    }
+    return result;
+  }
+
+  // xi_i and the estimate of k biased by `offset` (see RnsMontgomery)
+  uint64_t crt_terms(const std::array<uint64_t, N> &residues,
+                     std::array<uint64_t, N> &xi, double offset) const {
+    double fraction = offset;
+    for (size_t i = 0; i < N; ++i) {
+      xi[i] = channel_mul(residues[i], cofactor_inverse[i], primes[i]);
+      fraction += static_cast<double>(xi[i]) * reciprocal[i];
+    }
+    return fraction > 0 ? static_cast<uint64_t>(std::floor(fraction)) : 0;
+  }
+
+  DynamicInteger product() const {
+    DynamicInteger result(1);
+    for (uint64_t p : primes) {
+      result *= DynamicInteger(p);
+    }
+    return result;
+  }
+
+  DynamicInteger cofactor(size_t i) const {
+    DynamicInteger result(1);
+    for (size_t j = 0; j < N; ++j) {
+      if (j != i)
+        result *= DynamicInteger(primes[j]);
+    }
+    return result;
+  }
+};
+
+// Residues of `value` modulo each prime, two 32-bit halves per limb
+template <size_t N>
+std::array<uint64_t, N> rns_reduce(const DynamicInteger &value,
+                                   const std::array<uint64_t, N> &primes) {
+  std::array<uint64_t, N> residues{};
+  auto limbs = value.as_span();
+  for (size_t i = 0; i < N; ++i) {
+    uint64_t r = 0;
+    for (size_t l = limbs.size(); l > 0; --l) {
+      r = ((r << 32) | (limbs[l - 1] >> 32)) % primes[i];
+      r = ((r << 32) | (limbs[l - 1] & 0xFFFFFFFF)) % primes[i];
+    }
+    residues[i] = r;
+  }
+  return residues;
+}
+
+// Conversion constants cached per base on first use
+template <size_t N> struct RnsReconstruction {
+  DynamicInteger product;
+  std::array<DynamicInteger, N> cofactors;
+
+  explicit RnsReconstruction(const RnsBase<N> &base)
+      : product(base.product()) {
+    for (size_t i = 0; i < N; ++i) {
+      cofactors[i] = base.cofactor(i);
+    }
+  }
+
+  DynamicInteger reconstruct(const RnsBase<N> &base,
+                             const std::array<uint64_t, N> &residues) const {
+    std::array<uint64_t, N> xi;
+    // A slightly low estimate of k can only leave x one M too large
+    uint64_t k = base.crt_terms(residues, xi, -0x1p-30);
+    DynamicInteger x;
+    for (size_t i = 0; i < N; ++i) {
+      x += DynamicInteger(xi[i]) * cofactors[i];
+    }
+    x -= DynamicInteger(k) * product;
+    while (x >= product) {
+      x -= product;
+    }
+    return x;
+  }
+};
+
+template <size_t N>
+std::array<uint64_t, N> rns_extend_table_row(const RnsBase<N> &from,
+                                             uint64_t q) {
+  std::array<uint64_t, N> row{};
+  for (size_t i = 0; i < N; ++i) {
+    row[i] = from.cofactor_mod(i, q);
+  }
+  return row;
+}
+} // namespace detail
+
+// Integer modulo M = p_0 * ... * p_(NPrimes-1) held as one residue per prime
+// below 2^32. Addition, subtraction and multiplication act on every channel
+// independently; conversion to a DynamicInteger uses CRT with constants
+// derived from the prime set.
+template <size_t NPrimes>
+  requires(NPrimes > 0)
+class RnsInteger {
+public:
+  static constexpr size_t channels = NPrimes;
+  static constexpr detail::RnsBase<NPrimes> base{
+      detail::rns_primes<NPrimes>()};
+  using Residues = std::array<uint64_t, NPrimes>;
+
+  constexpr RnsInteger() = default;
+
+  explicit constexpr RnsInteger(std::integral auto value) {
+    static_assert(sizeof(decltype(value)) <= sizeof(uint64_t),
+                  "Integral value cannot be larger than Chunk value");
+    for (size_t i = 0; i < NPrimes; ++i) {
+      residues[i] = static_cast<uint64_t>(value) % base.primes[i];
+    }
+  }
+
+  // Reduces `value` modulo M
+  explicit RnsInteger(const DynamicInteger &value)
+      : residues(detail::rns_reduce(value, base.primes)) {}
+
+  static constexpr RnsInteger from_residues(const Residues &residues) {
+    RnsInteger result;
+    result.residues = residues;
+    return result;
+  }
+
+  // Product of all moduli; values are represented modulo this
+  static const DynamicInteger &modulus() { return reconstruction().product; }
+
+  DynamicInteger to_integer() const {
+    return reconstruction().reconstruct(base, residues);
+  }
+
+  constexpr const Residues &channel_residues() const { return residues; }
+
+  constexpr RnsInteger &operator+=(const RnsInteger &other) {
+    for (size_t i = 0; i < NPrimes; ++i) {
+      uint64_t sum = residues[i] + other.residues[i];
+      residues[i] = sum >= base.primes[i] ? sum - base.primes[i] : sum;
+    }
+    return *this;
+  }
+
+  constexpr RnsInteger &operator-=(const RnsInteger &other) {
+    for (size_t i = 0; i < NPrimes; ++i) {
+      uint64_t diff = residues[i] + base.primes[i] - other.residues[i];
+      residues[i] = diff >= base.primes[i] ? diff - base.primes[i] : diff;
+    }
+    return *this;
+  }
+
+  constexpr RnsInteger &operator*=(const RnsInteger &other) {
+    for (size_t i = 0; i < NPrimes; ++i) {
+      residues[i] =
+          detail::channel_mul(residues[i], other.residues[i], base.primes[i]);
+    }
+    return *this;
+  }
+
+  constexpr RnsInteger operator+(const RnsInteger &other) const {
+    RnsInteger result = *this;
+    result += other;
+    return result;
+  }
+
+  constexpr RnsInteger operator-(const RnsInteger &other) const {
+    RnsInteger result = *this;
+    result -= other;
+    return result;
+  }
+
+  constexpr RnsInteger operator*(const RnsInteger &other) const {
+    RnsInteger result = *this;
+    result *= other;
+    return result;
+  }
+
+  constexpr bool operator==(const RnsInteger &other) const = default;
+
+private:
+  Residues residues{};
+
+  static const detail::RnsReconstruction<NPrimes> &reconstruction() {
+    static const detail::RnsReconstruction<NPrimes> constants(base);
+    return constants;
+  }
+};
+
+// RNS Montgomery multiplication (Bajard-Imbert). Values are kept in two
+// bases B and B' of NPrimes channels each, with M = prod(B). multiply()
+// computes a * b * M^-1 mod n using only channel-wise operations plus two
+// base extensions:
+//   q = -a*b*n^-1 (mod B);  extend q to B'
+//   r = (a*b + q*n) / M   (in B', exact);  extend r back to B
+// The first extension may yield q + M, so results stay below 3n rather than
+// n; requiring 16n < min(M, M') keeps that bound stable and makes the second
+// extension exact.
+template <size_t NPrimes>
+  requires(NPrimes > 0)
+class RnsMontgomery {
+public:
+  using Residues = std::array<uint64_t, NPrimes>;
+
+  struct Element {
+    Residues main;
+    Residues extension;
+  };
+
+  static constexpr detail::RnsBase<NPrimes> main_base{
+      detail::rns_primes<NPrimes>()};
+  static constexpr detail::RnsBase<NPrimes> extension_base{
+      detail::rns_primes<NPrimes, NPrimes>()};
+
+  explicit RnsMontgomery(const DynamicInteger &modulus) : n(modulus) {
+    const DynamicInteger main_product = main_base.product();
+    const DynamicInteger extension_product = extension_base.product();
+    if (!modulus || modulus << 4 >= main_product ||
+        modulus << 4 >= extension_product) {
+      throw std::domain_error("RNS modulus out of range");
+    }
+
+    const Residues n_main = detail::rns_reduce(modulus, main_base.primes);
+    const Residues n_ext = detail::rns_reduce(modulus, extension_base.primes);
+    for (size_t i = 0; i < NPrimes; ++i) {
+      const uint64_t p = main_base.primes[i];
+      const uint64_t q = extension_base.primes[i];
+      if (n_main[i] == 0) {
+        throw std::domain_error("RNS modulus shares a factor with the base");
+      }
+      neg_n_inverse[i] = p - detail::channel_inverse(n_main[i], p);
+      n_extension[i] = n_ext[i];
+      m_inverse[i] = detail::channel_inverse(main_base.product_mod(q), q);
+      main_to_extension[i] = detail::rns_extend_table_row(main_base, q);
+      main_product_mod_ext[i] = main_base.product_mod(q);
+      extension_to_main[i] = detail::rns_extend_table_row(extension_base, p);
+      extension_product_mod_main[i] = extension_base.product_mod(p);
+    }
+
+    // M mod n and M^2 mod n move values into and out of Montgomery form
+    r_mod_n = main_product % modulus;
+    one = Element{Residues{}, Residues{}};
+    for (size_t i = 0; i < NPrimes; ++i) {
+      one.main[i] = 1;
+      one.extension[i] = 1;
+    }
+  }
+
+  const DynamicInteger &modulus() const { return n; }
+
+  // x * M mod n
+  Element to_montgomery(const DynamicInteger &value) const {
+    return make_element((value % n) * r_mod_n % n);
+  }
+
+  DynamicInteger from_montgomery(const Element &value) const {
+    Element plain = multiply(value, one);
+    DynamicInteger result =
+        main_reconstruction().reconstruct(main_base, plain.main);
+    while (result >= n) {
+      result -= n;
+    }
+    return result;
+  }
+
+  Element multiply(const Element &a, const Element &b) const {
+    Residues q;
+    for (size_t i = 0; i < NPrimes; ++i) {
+      const uint64_t p = main_base.primes[i];
+      q[i] = detail::channel_mul(detail::channel_mul(a.main[i], b.main[i], p),
+                                 neg_n_inverse[i], p);
+    }
+    // Biased low: k may be one short, giving q + M, which is tolerated
+    const Residues q_ext =
+        extend(main_base, extension_base, main_to_extension,
+               main_product_mod_ext, q, -0x1p-30);
+
+    Element result;
+    for (size_t i = 0; i < NPrimes; ++i) {
+      const uint64_t p = extension_base.primes[i];
+      uint64_t sum =
+          detail::channel_mul(a.extension[i], b.extension[i], p) +
+          detail::channel_mul(q_ext[i], n_extension[i], p);
+      result.extension[i] = detail::channel_mul(sum % p, m_inverse[i], p);
+    }
+    // r < 3n < M'/4, so offsetting by 1/4 makes the k estimate exact
+    result.main = extend(extension_base, main_base, extension_to_main,
+                         extension_product_mod_main, result.extension, 0.25);
+    return result;
+  }
+
+private:
+  using ExtensionTable = std::array<Residues, NPrimes>;
+
+  DynamicInteger n;
+  DynamicInteger r_mod_n;
+  Element one;
+  Residues neg_n_inverse;              // -n^-1 mod p_i
+  Residues n_extension;                // n mod p'_j
+  Residues m_inverse;                  // M^-1 mod p'_j
+  ExtensionTable main_to_extension;    // (M / p_i) mod p'_j, by j
+  Residues main_product_mod_ext;       // M mod p'_j
+  ExtensionTable extension_to_main;    // (M' / p'_j) mod p_i, by i
+  Residues extension_product_mod_main; // M' mod p_i
+
+  static const detail::RnsReconstruction<NPrimes> &main_reconstruction() {
+    static const detail::RnsReconstruction<NPrimes> constants(main_base);
+    return constants;
+  }
+
+  Element make_element(const DynamicInteger &value) const {
+    return Element{detail::rns_reduce(value, main_base.primes),
+                   detail::rns_reduce(value, extension_base.primes)};
+  }
+
+  // Base extension: x mod q_j = sum(xi_i * (M/p_i mod q_j)) - k * (M mod q_j)
+  static Residues extend(const detail::RnsBase<NPrimes> &from,
+                         const detail::RnsBase<NPrimes> &to,
+                         const ExtensionTable &cofactors,
+                         const Residues &product_mod, const Residues &residues,
+                         double offset) {
+    Residues xi;
+    const uint64_t k = from.crt_terms(residues, xi, offset);
+    Residues result;
+    for (size_t j = 0; j < NPrimes; ++j) {
+      const uint64_t q = to.primes[j];
+      uint64_t sum = 0;
+      for (size_t i = 0; i < NPrimes; ++i) {
+        sum = (sum + detail::channel_mul(xi[i], cofactors[j][i], q)) % q;
+      }
+      const uint64_t correction = detail::channel_mul(k % q, product_mod[j], q);
+      result[j] = (sum + q - correction) % q;
+    }
+    return result;
+  }
+};
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <concepts>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace ArbitraryPrecision {
+
+// Term n of a hypergeometric-like series
+//   S = sum_n a(n) / b(n) * (p(0) * ... * p(n)) / (q(0) * ... * q(n))
+// with nonnegative integers a, b, p, q; `negative` flips the sign of p(n).
+struct SeriesTerm {
+  DynamicInteger a{1};
+  DynamicInteger b{1};
+  DynamicInteger p{1};
+  DynamicInteger q{1};
+  bool negative = false;
+};
+
+// Products over a range [begin, end) of terms: p, q and b are the products
+// of the p(n), q(n) and b(n), and t = b * q * (partial sum of the range)
+struct SeriesSplit {
+  DynamicInteger p{1};
+  DynamicInteger q{1};
+  DynamicInteger b{1};
+  DynamicInteger t;
+  bool p_negative = false;
+  bool t_negative = false;
+};
+
+template <typename F>
+concept SeriesTerms = std::invocable<const F &, size_t> &&
+                      std::same_as<std::invoke_result_t<const F &, size_t>,
+                                   SeriesTerm>;
+
+namespace detail {
+// Signed sum of two magnitudes: (lhs_negative ? -lhs : lhs) + (...)
+inline std::pair<DynamicInteger, bool> signed_add(DynamicInteger lhs,
+                                                  bool lhs_negative,
+                                                  const DynamicInteger &rhs,
+                                                  bool rhs_negative) {
+  if (lhs_negative == rhs_negative) {
+    lhs += rhs;
+    return {std::move(lhs), lhs_negative && static_cast<bool>(lhs)};
+  }
+  if (lhs >= rhs) {
+    lhs -= rhs;
+    return {std::move(lhs), lhs_negative && static_cast<bool>(lhs)};
+  }
+  return {rhs - lhs, rhs_negative};
+}
+
+// Merges the splits of adjacent ranges [begin, mid) and [mid, end)
+inline SeriesSplit combine_splits(const SeriesSplit &left,
+                                  const SeriesSplit &right) {
+  SeriesSplit result;
+  auto [t, t_negative] = signed_add(
+      right.b * right.q * left.t, left.t_negative, left.b * left.p * right.t,
+      left.p_negative != right.t_negative);
+  result.t = std::move(t);
+  result.t_negative = t_negative;
+  result.p = left.p * right.p;
+  result.q = left.q * right.q;
+  result.b = left.b * right.b;
+  result.p_negative = left.p_negative != right.p_negative;
+  return result;
+}
+} // namespace detail
+
+// Binary splitting: evaluates the series over [begin, end) as one exact
+// fraction t / (b * q) by recursively merging halves, so the big
+// multiplications happen between operands of similar size.
+SeriesSplit binary_split(const SeriesTerms auto &terms, size_t begin,
+                         size_t end) {
+  if (begin >= end) {
+    throw std::domain_error("Empty series range");
+  }
+  if (end - begin == 1) {
+    SeriesTerm term = terms(begin);
+    SeriesSplit leaf;
+    leaf.t = term.a * term.p;
+    leaf.t_negative = term.negative && static_cast<bool>(leaf.t);
+    leaf.p = std::move(term.p);
+    leaf.q = std::move(term.q);
+    leaf.b = std::move(term.b);
+    leaf.p_negative = term.negative;
+    return leaf;
+  }
+
+  const size_t mid = begin + (end - begin) / 2;
+  return detail::combine_splits(binary_split(terms, begin, mid),
+                                binary_split(terms, mid, end));
+}
+
+namespace detail {
+// Ranges shorter than this are not worth a thread
+inline constexpr size_t parallel_split_threshold = 64;
+
+// Runs on a new thread when one is left in the budget, else on get()
+inline std::launch launch_within(size_t threads, size_t needed) {
+  return threads >= needed ? std::launch::async : std::launch::deferred;
+}
+
+// combine_splits with the two halves of t and the p/q/b products computed
+// concurrently on up to `threads` threads, counting the caller; these are
+// the largest multiplications of the whole series
+inline SeriesSplit combine_splits_parallel(const SeriesSplit &left,
+                                           const SeriesSplit &right,
+                                           size_t threads) {
+  auto products = std::async(launch_within(threads, 2), [&] {
+    return std::tuple(left.p * right.p, left.q * right.q, left.b * right.b);
+  });
+  auto rhs = std::async(launch_within(threads, 3),
+                        [&] { return left.b * left.p * right.t; });
+  DynamicInteger lhs = right.b * right.q * left.t;
+
+  SeriesSplit result;
+  auto [t, t_negative] = signed_add(std::move(lhs), left.t_negative, rhs.get(),
+                                    left.p_negative != right.t_negative);
+  result.t = std::move(t);
+  result.t_negative = t_negative;
+  std::tie(result.p, result.q, result.b) = products.get();
+  result.p_negative = left.p_negative != right.p_negative;
+  return result;
+}
+} // namespace detail
+
+// binary_split with the upper levels of the recursion spread over `threads`
+// threads: the right half of each range runs asynchronously, and merges at
+// those levels multiply concurrently. A merge only starts once both halves
+// have finished, so it reuses their share of the budget and at most
+// `threads` threads run at any time. `terms` is called from several threads
+// at once.
+SeriesSplit
+parallel_binary_split(const SeriesTerms auto &terms, size_t begin, size_t end,
+                      size_t threads = std::thread::hardware_concurrency()) {
+  if (threads <= 1 || end - begin < detail::parallel_split_threshold) {
+    return binary_split(terms, begin, end);
+  }
+  const size_t mid = begin + (end - begin) / 2;
+  const size_t right_threads = threads / 2;
+  auto right = std::async(std::launch::async, [&] {
+    return parallel_binary_split(terms, mid, end, right_threads);
+  });
+  SeriesSplit left =
+      parallel_binary_split(terms, begin, mid, threads - right_threads);
+  return detail::combine_splits_parallel(left, right.get(), threads);
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace ArbitraryPrecision {
+
+// Copy-on-write DynamicInteger. Copies share one refcounted limb buffer and
+// cost O(1); the first mutation of a shared value detaches it with a deep
+// copy. Reference counting is atomic, and dropping an owner releases what
+// the uniqueness check in mutate() acquires, so copies of the same value may
+// be used and mutated on different threads; a single SharedInteger object is
+// no more thread-safe than a std::shared_ptr.
+class SharedInteger {
+public:
+  SharedInteger() : storage(new Buffer(DynamicInteger())) {}
+
+  explicit SharedInteger(DynamicInteger value)
+      : storage(new Buffer(std::move(value))) {}
+
+  explicit SharedInteger(std::integral auto value)
+      : SharedInteger(DynamicInteger(value)) {}
+
+  // No move operations: moving would leave a null buffer behind, and a copy
+  // is only a refcount increment anyway
+  SharedInteger(const SharedInteger &other) : storage(other.storage) {
+    storage->owners.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  SharedInteger &operator=(const SharedInteger &other) {
+    other.storage->owners.fetch_add(1, std::memory_order_relaxed);
+    release();
+    storage = other.storage;
+    return *this;
+  }
+
+  ~SharedInteger() { release(); }
+
+  const DynamicInteger &value() const { return storage->value; }
+
+  size_t length() const { return value().length(); }
+  size_t bits() const { return value().bits(); }
+  uint64_t tail() const { return value().tail(); }
+
+  // Number of SharedIntegers referring to the same buffer
+  long use_count() const {
+    return storage->owners.load(std::memory_order_relaxed);
+  }
+
+  bool shares_storage_with(const SharedInteger &other) const {
+    return storage == other.storage;
+  }
+
+  // Detaches from other owners if needed and returns the private value
+  DynamicInteger &mutate() {
+    // Acquire pairs with the release in other owners' release(), so their
+    // last reads of the limbs happen before an in-place write
+    if (storage->owners.load(std::memory_order_acquire) != 1) {
+      Buffer *copy = new Buffer(storage->value);
+      release();
+      storage = copy;
+    }
+    return storage->value;
+  }
+
+  // Compound assignment (detaches)
+  SharedInteger &operator+=(const SharedInteger &other) {
+    mutate() += other.value();
+    return *this;
+  }
+
+  SharedInteger &operator-=(const SharedInteger &other) {
+    mutate() -= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator*=(const SharedInteger &other) {
+    mutate() *= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator/=(const SharedInteger &other) {
+    mutate() /= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator%=(const SharedInteger &other) {
+    mutate() %= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator&=(const SharedInteger &other) {
+    mutate() &= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator|=(const SharedInteger &other) {
+    mutate() |= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator^=(const SharedInteger &other) {
+    mutate() ^= other.value();
+    return *this;
+  }
+
+  SharedInteger &operator<<=(size_t shift) {
+    mutate() <<= shift;
+    return *this;
+  }
+
+  SharedInteger &operator>>=(size_t shift) {
+    mutate() >>= shift;
+    return *this;
+  }
+
+  SharedInteger &operator++() {
+    ++mutate();
+    return *this;
+  }
+
+  SharedInteger &operator--() {
+    --mutate();
+    return *this;
+  }
+
+  // Binary operators produce a fresh, unshared value
+  SharedInteger operator+(const SharedInteger &other) const {
+    return SharedInteger(value() + other.value());
+  }
+
+  SharedInteger operator-(const SharedInteger &other) const {
+    return SharedInteger(value() - other.value());
+  }
+
+  SharedInteger operator*(const SharedInteger &other) const {
+    return SharedInteger(value() * other.value());
+  }
+
+  SharedInteger operator/(const SharedInteger &other) const {
+    return SharedInteger(value() / other.value());
+  }
+
+  SharedInteger operator%(const SharedInteger &other) const {
+    return SharedInteger(value() % other.value());
+  }
+
+  SharedInteger operator&(const SharedInteger &other) const {
+    return SharedInteger(value() & other.value());
+  }
+
+  SharedInteger operator|(const SharedInteger &other) const {
+    return SharedInteger(value() | other.value());
+  }
+
+  SharedInteger operator^(const SharedInteger &other) const {
+    return SharedInteger(value() ^ other.value());
+  }
+
+  SharedInteger operator<<(size_t shift) const {
+    return SharedInteger(value() << shift);
+  }
+
+  SharedInteger operator>>(size_t shift) const {
+    return SharedInteger(value() >> shift);
+  }
+
+  // Comparisons short-circuit when both sides share storage
+  std::strong_ordering operator<=>(const SharedInteger &other) const {
+    if (shares_storage_with(other)) {
+      return std::strong_ordering::equal;
+    }
+    return value() <=> other.value();
+  }
+
+  bool operator==(const SharedInteger &other) const {
+    return shares_storage_with(other) || value() == other.value();
+  }
+
+  explicit operator bool() const { return static_cast<bool>(value()); }
+
+private:
+  struct Buffer {
+    explicit Buffer(DynamicInteger value) : value(std::move(value)) {}
+    DynamicInteger value;
+    std::atomic<long> owners{1};
+  };
+
+  Buffer *storage;
+
+  void release() {
+    if (storage->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete storage;
+    }
+  }
+};
+
+inline std::string to_string(const SharedInteger &value) {
+  return to_string(value.value());
+}
+
+// Interning pool for repeated constants. Equal values are stored once, and
+// intern() hands out Handles pointing at that immutable copy, so two Handles
+// from the same pool are equal exactly when their pointers are. Handles stay
+// valid for the lifetime of the pool; interning is thread-safe.
+class IntegerPool {
+public:
+  class Handle {
+  public:
+    const DynamicInteger &value() const { return *pointer; }
+    const DynamicInteger *operator->() const { return pointer; }
+    const DynamicInteger &operator*() const { return *pointer; }
+
+    // Only meaningful for Handles from the same pool
+    bool operator==(const Handle &other) const {
+      return pointer == other.pointer;
+    }
+
+    std::strong_ordering operator<=>(const Handle &other) const {
+      if (pointer == other.pointer) {
+        return std::strong_ordering::equal;
+      }
+      return *pointer <=> *other.pointer;
+    }
+
+  private:
+    friend class IntegerPool;
+    explicit Handle(const DynamicInteger *pointer) : pointer(pointer) {}
+
+    const DynamicInteger *pointer;
+  };
+
+  IntegerPool() = default;
+  IntegerPool(const IntegerPool &) = delete;
+  IntegerPool &operator=(const IntegerPool &) = delete;
+
+  Handle intern(const DynamicInteger &value) {
+    std::lock_guard lock(mutex);
+    return Handle(&*values.insert(value).first);
+  }
+
+  Handle intern(DynamicInteger &&value) {
+    std::lock_guard lock(mutex);
+    return Handle(&*values.insert(std::move(value)).first);
+  }
+
+  // Returns the Handle for `value` if it has been interned
+  std::optional<Handle> find(const DynamicInteger &value) const {
+    std::lock_guard lock(mutex);
+    auto it = values.find(value);
+    if (it == values.end()) {
+      return std::nullopt;
+    }
+    return Handle(&*it);
+  }
+
+  size_t size() const {
+    std::lock_guard lock(mutex);
+    return values.size();
+  }
+
+private:
+  mutable std::mutex mutex;
+  // Node-based, so element addresses are stable across rehashing
+  std::unordered_set<DynamicInteger> values;
+};
+
+} // namespace ArbitraryPrecision
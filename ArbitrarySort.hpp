@@ -0,0 +1,173 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ArbitraryPrecision {
+
+namespace detail {
+// Buckets smaller than this are finished with a comparison sort
+inline constexpr size_t radix_sort_threshold = 64;
+
+using RadixCounts = std::array<size_t, 256>;
+
+// Digit 0 is the least significant byte of the key
+template <size_t Bits>
+constexpr size_t radix_digit(const FixedInteger<Bits> &value, size_t digit) {
+  return (value.as_span()[digit / 8] >> (8 * (digit % 8))) & 0xFF;
+}
+
+// Partitions `values` in place by `digit` (American flag sort) and returns
+// the bucket boundaries, or nothing if every key has the same digit.
+template <size_t Bits>
+std::optional<std::array<size_t, 257>>
+radix_partition(std::span<FixedInteger<Bits>> values, size_t digit) {
+  RadixCounts counts{};
+  for (const auto &value : values) {
+    ++counts[radix_digit(value, digit)];
+  }
+  if (std::ranges::find(counts, values.size()) != counts.end()) {
+    return std::nullopt;
+  }
+
+  std::array<size_t, 257> bounds;
+  bounds[0] = 0;
+  for (size_t bucket = 0; bucket < 256; ++bucket) {
+    bounds[bucket + 1] = bounds[bucket] + counts[bucket];
+  }
+
+  // Swap each key straight into the next free slot of its bucket
+  RadixCounts next;
+  std::copy(bounds.begin(), bounds.end() - 1, next.begin());
+  for (size_t bucket = 0; bucket < 256; ++bucket) {
+    while (next[bucket] < bounds[bucket + 1]) {
+      size_t target = radix_digit(values[next[bucket]], digit);
+      if (target == bucket) {
+        ++next[bucket];
+      } else {
+        std::swap(values[next[bucket]], values[next[target]++]);
+      }
+    }
+  }
+  return bounds;
+}
+
+// MSD radix sort on digits [0, digits), most significant first
+template <size_t Bits>
+void radix_sort(std::span<FixedInteger<Bits>> values, size_t digits) {
+  while (digits > 0 && values.size() >= radix_sort_threshold) {
+    --digits;
+    auto bounds = radix_partition(values, digits);
+    if (!bounds) {
+      continue; // every key shares this digit
+    }
+    for (size_t bucket = 0; bucket < 256; ++bucket) {
+      radix_sort(values.subspan((*bounds)[bucket],
+                                (*bounds)[bucket + 1] - (*bounds)[bucket]),
+                 digits);
+    }
+    return;
+  }
+  if (digits > 0) {
+    std::sort(values.begin(), values.end());
+  }
+}
+} // namespace detail
+
+// In-place MSD radix sort over 8-bit digits, most significant byte first.
+// Digits shared by every key in a bucket (e.g. high zero bytes) cost one
+// counting pass and no data movement, and small buckets are finished with
+// std::sort, so random keys are usually settled after one or two passes.
+template <size_t Bits> void sort(std::span<FixedInteger<Bits>> values) {
+  detail::radix_sort(values, Bits / 8);
+}
+
+// Parallel variant: partitions sequentially down to the first digit that
+// splits the keys, then sorts the resulting buckets on `threads` workers,
+// each claiming the next unsorted bucket.
+template <size_t Bits>
+void parallel_sort(std::span<FixedInteger<Bits>> values,
+                   size_t threads = std::thread::hardware_concurrency()) {
+  size_t digits = Bits / 8;
+  std::optional<std::array<size_t, 257>> bounds;
+  while (threads > 1 && digits > 0 &&
+         values.size() >= detail::radix_sort_threshold * threads && !bounds) {
+    bounds = detail::radix_partition(values, --digits);
+  }
+  if (!bounds) {
+    detail::radix_sort(values, digits);
+    return;
+  }
+
+  std::atomic<size_t> next_bucket{0};
+  auto worker = [&] {
+    for (size_t bucket; (bucket = next_bucket++) < 256;) {
+      detail::radix_sort(values.subspan((*bounds)[bucket],
+                                        (*bounds)[bucket + 1] -
+                                            (*bounds)[bucket]),
+                         digits);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (size_t t = 1; t < threads; ++t) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : workers) {
+    thread.join();
+  }
+}
+
+// Sorts DynamicIntegers by first bucketing on significant length (trimmed
+// values with more limbs are always larger), then comparison-sorting each
+// bucket, where comparisons only ever see equal-length operands.
+inline void sort(std::span<DynamicInteger> values) {
+  if (values.size() < 2) {
+    return;
+  }
+
+  size_t max_length = 0;
+  for (const auto &value : values) {
+    max_length = std::max(max_length, value.length());
+  }
+
+  std::vector<size_t> offsets(max_length + 2, 0);
+  for (const auto &value : values) {
+    ++offsets[value.length() + 1];
+  }
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  // Swap each value straight into the next free slot of its bucket, as in
+  // radix_partition; swaps only exchange limb buffers, so nothing is
+  // allocated or copied
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t length = 0; length <= max_length; ++length) {
+    while (next[length] < offsets[length + 1]) {
+      const size_t target = values[next[length]].length();
+      if (target == length) {
+        ++next[length];
+      } else {
+        std::swap(values[next[length]], values[next[target]++]);
+      }
+    }
+  }
+
+  for (size_t length = 1; length <= max_length; ++length) {
+    std::sort(values.begin() + static_cast<std::ptrdiff_t>(offsets[length]),
+              values.begin() +
+                  static_cast<std::ptrdiff_t>(offsets[length + 1]));
+  }
+}
+
+} // namespace ArbitraryPrecision
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <ArbitraryInteger.hpp>
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ArbitraryPrecision::trace {
+
+// Collects trace events in memory and writes them in the Chrome trace-event
+// JSON format, loadable in chrome://tracing or Perfetto.
+//
+//   ChromeTraceWriter writer;
+//   trace::set_hooks(&writer.hooks());
+//   ... run workload ...
+//   trace::set_hooks(nullptr);
+//   writer.write(std::ofstream("trace.json"));
+class ChromeTraceWriter {
+public:
+  explicit ChromeTraceWriter(size_t min_limbs = 0)
+      : origin(std::chrono::steady_clock::now()) {
+    table.begin = &ChromeTraceWriter::on_begin;
+    table.end = &ChromeTraceWriter::on_end;
+    table.user = this;
+    table.min_limbs = min_limbs;
+  }
+
+  ChromeTraceWriter(const ChromeTraceWriter &) = delete;
+  ChromeTraceWriter &operator=(const ChromeTraceWriter &) = delete;
+
+  const Hooks &hooks() const { return table; }
+
+  size_t size() const {
+    std::lock_guard lock(mutex);
+    return records.size();
+  }
+
+  void write(std::ostream &out) const {
+    std::lock_guard lock(mutex);
+    out << "{\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+      const Record &r = records[i];
+      if (i > 0)
+        out << ',';
+      out << "\n{\"name\":\"" << r.operation
+          << "\",\"cat\":\"ArbitraryInteger\",\"ph\":\"" << r.phase
+          << "\",\"ts\":" << r.timestamp_us << ",\"pid\":1,\"tid\":" << r.tid
+          << ",\"args\":{\"algorithm\":\"" << r.algorithm
+          << "\",\"lhs_limbs\":" << r.lhs_limbs
+          << ",\"rhs_limbs\":" << r.rhs_limbs << "}}";
+    }
+    out << "\n]}\n";
+  }
+
+  void write(std::ostream &&out) const { write(out); }
+
+  void clear() {
+    std::lock_guard lock(mutex);
+    records.clear();
+  }
+
+private:
+  struct Record {
+    std::string_view operation;
+    std::string_view algorithm;
+    size_t lhs_limbs;
+    size_t rhs_limbs;
+    char phase;
+    double timestamp_us;
+    size_t tid;
+  };
+
+  Hooks table;
+  std::chrono::steady_clock::time_point origin;
+  mutable std::mutex mutex;
+  std::vector<Record> records;
+
+  void record(const Event &event, char phase) {
+    double ts = std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - origin)
+                    .count();
+    static std::atomic<size_t> next_tid{1};
+    thread_local const size_t tid = next_tid.fetch_add(1);
+    std::lock_guard lock(mutex);
+    records.push_back({event.operation, event.algorithm, event.lhs_limbs,
+                       event.rhs_limbs, phase, ts, tid});
+  }
+
+  static void on_begin(const Event &event, void *user) {
+    static_cast<ChromeTraceWriter *>(user)->record(event, 'B');
+  }
+
+  static void on_end(const Event &event, void *user) {
+    static_cast<ChromeTraceWriter *>(user)->record(event, 'E');
+  }
+};
+
+} // namespace ArbitraryPrecision::trace
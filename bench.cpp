@@ -0,0 +1,438 @@
+#include <ArbitraryConstants.hpp>
+#include <ArbitraryCurve.hpp>
+#include <ArbitraryInteger.hpp>
+#include <ArbitraryMontgomery.hpp>
+#include <ArbitrarySort.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(ARBITRARY_INTEGER_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HAS_PERF_COUNTERS 1
+#else
+#define HAS_PERF_COUNTERS 0
+#endif
+
+using namespace ArbitraryPrecision;
+
+namespace {
+
+// Keep the compiler from discarding a benchmarked result
+template <typename T> void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void *sink;
+  sink = &value;
+#endif
+}
+
+struct CounterValues {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t branch_misses = 0;
+  uint64_t cache_misses = 0;
+};
+
+// Hardware counters read through perf_event_open, opened as a single group so
+// that all four events are scheduled together. When the kernel refuses access
+// (perf_event_paranoid, containers, non-Linux builds) `available()` is false
+// and only wall-clock numbers are reported.
+class PerfCounters {
+public:
+#if HAS_PERF_COUNTERS
+  PerfCounters() {
+    const uint64_t configs[] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES};
+    for (size_t i = 0; i < 4; ++i) {
+      perf_event_attr attr{};
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = configs[i];
+      attr.disabled = (i == 0) ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      fds[i] = static_cast<int>(
+          syscall(__NR_perf_event_open, &attr, 0, -1, fds[0], 0));
+      if (fds[i] < 0) {
+        close_all();
+        return;
+      }
+    }
+  }
+
+  ~PerfCounters() { close_all(); }
+
+  bool available() const { return fds[0] >= 0; }
+
+  void start() {
+    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  CounterValues stop() {
+    ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // PERF_FORMAT_GROUP layout: nr, then one value per event
+    uint64_t data[5] = {};
+    if (read(fds[0], data, sizeof(data)) != sizeof(data)) {
+      return {};
+    }
+    return {data[1], data[2], data[3], data[4]};
+  }
+
+private:
+  int fds[4] = {-1, -1, -1, -1};
+
+  void close_all() {
+    for (auto &fd : fds) {
+      if (fd >= 0)
+        close(fd);
+      fd = -1;
+    }
+  }
+#else
+  PerfCounters() = default;
+  bool available() const { return false; }
+  void start() {}
+  CounterValues stop() { return {}; }
+#endif
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+};
+
+PerfCounters counters;
+
+// Runs `kernel` for `iterations` rounds and prints one report line.
+// `limbs` is the operand size used to normalize cycles per limb.
+template <typename Kernel>
+void measure(const char *name, size_t limbs, size_t iterations,
+             Kernel &&kernel) {
+  kernel(); // warm up caches and the branch predictor
+
+  if (counters.available())
+    counters.start();
+  auto begin = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    kernel();
+  }
+  auto end = std::chrono::steady_clock::now();
+  CounterValues values =
+      counters.available() ? counters.stop() : CounterValues{};
+
+  double ns = std::chrono::duration<double, std::nano>(end - begin).count() /
+              static_cast<double>(iterations);
+
+  std::printf("%-28s %6zu %12.1f", name, limbs, ns);
+  if (counters.available()) {
+    double n = static_cast<double>(iterations);
+    double cycles = static_cast<double>(values.cycles) / n;
+    double ipc = values.cycles ? static_cast<double>(values.instructions) /
+                                     static_cast<double>(values.cycles)
+                               : 0.0;
+    std::printf(" %12.1f %6.2f %12.2f %10.2f %10.2f", cycles, ipc,
+                cycles / static_cast<double>(limbs),
+                static_cast<double>(values.branch_misses) / n,
+                static_cast<double>(values.cache_misses) / n);
+  }
+  std::printf("\n");
+}
+
+std::mt19937_64 rng(0x5eed);
+
+template <size_t Bits> FixedInteger<Bits> random_fixed() {
+  FixedInteger<Bits> value;
+  for (auto &limb : value.as_span()) {
+    limb = rng();
+  }
+  return value;
+}
+
+DynamicInteger random_dynamic(size_t limbs) {
+  // Allocate `limbs` segments, then overwrite them in place
+  DynamicInteger value = DynamicInteger(1) << (64 * (limbs - 1));
+  for (auto &limb : value.as_span()) {
+    limb = rng();
+  }
+  value.as_span()[limbs - 1] |= 1ULL << 63;
+  return value;
+}
+
+template <size_t Bits> void bench_fixed() {
+  constexpr size_t limbs = Bits / 64;
+  const auto a = random_fixed<Bits>();
+  const auto b = random_fixed<Bits>();
+  const auto small = random_fixed<Bits>() >> (Bits / 2);
+  const std::string suffix = "<" + std::to_string(Bits) + ">";
+
+  measure(("Fixed add" + suffix).c_str(), limbs, 1000000,
+          [&] { do_not_optimize(a + b); });
+  measure(("Fixed mul" + suffix).c_str(), limbs, 100000,
+          [&] { do_not_optimize(a * b); });
+  measure(("Fixed div" + suffix).c_str(), limbs, 2000,
+          [&] { do_not_optimize(a / small); });
+  measure(("Fixed to_string" + suffix).c_str(), limbs, 20,
+          [&] { do_not_optimize(to_string(a)); });
+}
+
+void bench_dynamic(size_t limbs) {
+  const auto a = random_dynamic(limbs);
+  const auto b = random_dynamic(limbs);
+  const auto half = random_dynamic(limbs / 2 + 1);
+  const size_t scale = 64 / limbs + 1;
+
+  measure("Dynamic add", limbs, 20000 * scale,
+          [&] { do_not_optimize(a + b); });
+  measure("Dynamic mul", limbs, 500 * scale, [&] { do_not_optimize(a * b); });
+  measure("Dynamic div", limbs, 20 * scale,
+          [&] { do_not_optimize(a / half); });
+  const DynamicInteger power = DynamicInteger(1) << (limbs * 32 + 5);
+  measure("Dynamic div/mod 2^k", limbs, 2000 * scale,
+          [&] { do_not_optimize(a / power + a % power); });
+  measure("Dynamic to_string", limbs, scale,
+          [&] { do_not_optimize(to_string(a)); });
+}
+
+template <size_t Bits> void bench_sort(size_t count) {
+  std::vector<FixedInteger<Bits>> keys(count);
+  for (auto &key : keys) {
+    key = random_fixed<Bits>();
+  }
+  std::vector<FixedInteger<Bits>> work;
+  const std::string suffix = "<" + std::to_string(Bits) + ">";
+
+  // Normalized by the total number of key limbs sorted
+  measure(("std::sort" + suffix).c_str(), count * (Bits / 64), 3, [&] {
+    work = keys;
+    std::sort(work.begin(), work.end());
+  });
+  measure(("radix sort" + suffix).c_str(), count * (Bits / 64), 3, [&] {
+    work = keys;
+    sort(std::span(work));
+  });
+  measure(("parallel radix sort" + suffix).c_str(), count * (Bits / 64), 3,
+          [&] {
+            work = keys;
+            parallel_sort(std::span(work));
+          });
+}
+
+// End-to-end: series evaluation (multiplication), the final division and
+// square root, then decimal conversion of the result
+void bench_constants(size_t digits) {
+  const auto bits = static_cast<size_t>(static_cast<double>(digits) * 3.3220);
+  const size_t limbs = bits / 64;
+
+  measure("pi (Chudnovsky)", limbs, 1,
+          [&] { do_not_optimize(constants::pi(bits)); });
+  measure("pi (1 thread)", limbs, 1,
+          [&] { do_not_optimize(constants::pi(bits, 1)); });
+  measure("e", limbs, 1, [&] { do_not_optimize(constants::e(bits)); });
+  const BigFloat pi = constants::pi(bits);
+  measure("pi to_string", limbs, 1,
+          [&] { do_not_optimize(to_string(pi, digits)); });
+}
+
+// Field multiplication against the generic `%` it replaces, then point
+// operations on the secp256k1 curve
+void bench_curves() {
+  using Field = Secp256k1::Field;
+  using Point = JacobianPoint<Secp256k1>;
+  const auto modulus = DynamicInteger(Secp256k1Field::modulus);
+  const Field a(random_fixed<256>());
+  const Field b(random_fixed<256>());
+  const auto scalar = random_fixed<256>();
+
+  measure("field mul (generic %)", 4, 100000, [&] {
+    do_not_optimize(DynamicInteger(a.value()) * DynamicInteger(b.value()) %
+                    modulus);
+  });
+  measure("field mul (secp256k1)", 4, 1000000,
+          [&] { do_not_optimize(a * b); });
+  measure("scalar mul (secp256k1)", 4, 200, [&] {
+    do_not_optimize(scalar_multiply(Point::generator(), scalar));
+  });
+
+  std::vector<Point> points;
+  std::vector<FixedInteger<256>> scalars;
+  for (size_t i = 0; i < 256; ++i) {
+    points.push_back(scalar_multiply(Point::generator(), random_fixed<256>()));
+    scalars.push_back(random_fixed<256>());
+  }
+  // Normalized per point
+  measure("MSM x256 (Pippenger)", 256, 2, [&] {
+    do_not_optimize(multi_scalar_multiply<Point>(points, scalars));
+  });
+}
+
+// RSA-2048 private-key operation: one full-size Montgomery powmod against
+// the CRT split into two 1024-bit halves
+void bench_rsa() {
+  using Key = FixedInteger<2048>;
+  using Half = FixedInteger<1024>;
+  const Half p = from_string<Half>(
+    "104070538462224854464002353735483413089818090014985297972941291437421590"
+    "747885129205969301177368250240670728864217008348199787450347285214253016"
+    "038397776747073523121376813872586855988974265279595282323898348533665606"
+    "065922267388357407322527500097796230746843732908176612402678248610785665"
+    "523583693711821973709").value();
+  const Half q = from_string<Half>(
+    "130733791106978453753696462788901302020003898909503054521526185268700699"
+    "683220976047383388283103063024951892901121320469387204666851104340766216"
+    "601154748344098781014204810719453999961038004636479402636698416017085400"
+    "588693497095214603842454535886545773116076393313667997636007690555545040"
+    "020095342198327365419").value();
+  const Key d = from_string<Key>(
+    "128677918623093865861922121391038245603018491543186284990764000686102477"
+    "598542163339447025994313052245766687464806548393079635180443355150365888"
+    "580023798748544073347043627376369484860306113331631802793735287805605224"
+    "463706899851332476767839561743223643615266035387040999728223602662544565"
+    "212421936937852306163485622550982262662541574323322365044022855537373560"
+    "958426807761182928612535254851661570404071204474802156182603511344112889"
+    "481762582893452573194680949891956288338474191768127140199847801851139397"
+    "932105492642727125338202349875794562361614096828030524650815246492968612"
+    "1833439888091014830136065465678173855353").value();
+  const CrtPowContext<2048> context(p, q, d);
+  const Key cipher = random_fixed<2048>() % context.modulus();
+
+  measure("RSA-2048 powmod", 32, 3,
+          [&] { do_not_optimize(powmod(cipher, d, context.modulus())); });
+  measure("RSA-2048 CRT (1 thread)", 32, 10,
+          [&] { do_not_optimize(context.pow(cipher, 1)); });
+  measure("RSA-2048 CRT (2 threads)", 32, 10,
+          [&] { do_not_optimize(context.pow(cipher, 2)); });
+}
+
+// g^a h^b mod n as two powmods and a product against one shared chain of
+// squarings, then a 256-base product through the Pippenger path
+void bench_multi_powmod() {
+  using Value = FixedInteger<2048>;
+  Value modulus = random_fixed<2048>();
+  modulus.as_span()[0] |= 1;
+  const std::vector<Value> bases = {random_fixed<2048>() % modulus,
+                                    random_fixed<2048>() % modulus};
+  const std::vector<Value> exponents = {random_fixed<2048>(),
+                                        random_fixed<2048>()};
+
+  measure("g^a h^b (two powmods)", 32, 3, [&] {
+    const DynamicInteger product =
+        DynamicInteger(powmod(bases[0], exponents[0], modulus)) *
+        DynamicInteger(powmod(bases[1], exponents[1], modulus)) %
+        DynamicInteger(modulus);
+    do_not_optimize(product);
+  });
+  measure("g^a h^b (Straus)", 32, 3, [&] {
+    do_not_optimize(multi_powmod<2048>(bases, exponents, modulus));
+  });
+
+  std::vector<FixedInteger<256>> many_bases, many_exponents;
+  FixedInteger<256> small_modulus = random_fixed<256>();
+  small_modulus.as_span()[0] |= 1;
+  for (size_t i = 0; i < 256; ++i) {
+    many_bases.push_back(random_fixed<256>() % small_modulus);
+    many_exponents.push_back(random_fixed<256>());
+  }
+  // Normalized per base
+  measure("256 powers (Pippenger)", 256, 5, [&] {
+    do_not_optimize(
+        multi_powmod<256>(many_bases, many_exponents, small_modulus));
+  });
+}
+
+// 2048-bit powers of one base: powmod against comb tables of two sizes
+void bench_fixed_base() {
+  using Value = FixedInteger<2048>;
+  Value modulus = random_fixed<2048>();
+  modulus.as_span()[0] |= 1;
+  const Value base = random_fixed<2048>() % modulus;
+  const Value exponent = random_fixed<2048>();
+  const FixedBasePow<2048> small(base, modulus);
+  const FixedBasePow<2048> large(base, modulus, 8, 32);
+
+  measure("powmod (2048)", 32, 3,
+          [&] { do_not_optimize(powmod(base, exponent, modulus)); });
+  measure("comb 4x8 (2048)", 32, 10,
+          [&] { do_not_optimize(small.pow(exponent)); });
+  measure("comb 8x32 (2048)", 32, 10,
+          [&] { do_not_optimize(large.pow(exponent)); });
+}
+
+// 256-bit inverses modulo the secp256k1 prime: Fermat's little theorem
+// against the binary extended Euclid and constant-time safegcd
+void bench_modinv() {
+  const FixedInteger<256> modulus = Secp256k1Field::modulus;
+  const FixedInteger<256> value = random_fixed<256>() % modulus;
+
+  measure("inverse (Fermat powmod)", 4, 1000, [&] {
+    do_not_optimize(powmod(value, modulus - FixedInteger<256>(2), modulus));
+  });
+  measure("modinv (binary)", 4, 1000,
+          [&] { do_not_optimize(modinv(value, modulus)); });
+  measure("modinv (safegcd)", 4, 1000,
+          [&] { do_not_optimize(modinv_constant_time(value, modulus)); });
+}
+
+void bench_divexact(size_t limbs) {
+  const auto quotient = random_dynamic(limbs);
+  const auto divisor = random_dynamic(limbs / 2);
+  const auto product = quotient * divisor;
+  const uint64_t small = divisor.tail() | 1;
+  const auto scaled = quotient * DynamicInteger(small);
+
+  measure("divide (exact quotient)", limbs, 20,
+          [&] { do_not_optimize(product / divisor); });
+  measure("divexact", limbs, 2000,
+          [&] { do_not_optimize(divexact(product, divisor)); });
+  measure("divide by limb", limbs, 20,
+          [&] { do_not_optimize(scaled / DynamicInteger(small)); });
+  measure("divexact_1", limbs, 20000,
+          [&] { do_not_optimize(divexact_1(scaled, small)); });
+}
+
+} // namespace
+
+int main() {
+  std::printf("%-28s %6s %12s", "kernel", "limbs", "ns/op");
+  if (counters.available()) {
+    std::printf(" %12s %6s %12s %10s %10s", "cycles/op", "IPC", "cycles/limb",
+                "br-miss/op", "$-miss/op");
+  }
+  std::printf("\n");
+#if HAS_PERF_COUNTERS
+  if (!counters.available()) {
+    std::printf("(perf_event_open unavailable, reporting wall-clock only)\n");
+  }
+#endif
+
+  bench_fixed<256>();
+  bench_fixed<1024>();
+
+  for (size_t limbs : {4, 16, 64}) {
+    bench_dynamic(limbs);
+  }
+
+  bench_sort<128>(1 << 20);
+  bench_sort<256>(1 << 20);
+
+  for (size_t digits : {1000, 10000, 50000}) {
+    bench_constants(digits);
+  }
+
+  bench_curves();
+  bench_rsa();
+  bench_multi_powmod();
+  bench_fixed_base();
+  bench_modinv();
+  for (size_t limbs : {8, 64}) {
+    bench_divexact(limbs);
+  }
+}
@@ -1,7 +1,31 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <ArbitraryAsync.hpp>
+#include <ArbitraryConstants.hpp>
+#include <ArbitraryCrt.hpp>
+#include <ArbitraryCurve.hpp>
+#include <ArbitraryDecimal.hpp>
+#include <ArbitraryFloat.hpp>
 #include <ArbitraryInteger.hpp>
+#include <ArbitraryMatrix.hpp>
+#include <ArbitraryModular.hpp>
+#include <ArbitraryMontgomery.hpp>
+#include <ArbitraryPolynomial.hpp>
+#include <ArbitraryRational.hpp>
+#include <ArbitraryRns.hpp>
+#include <ArbitraryShared.hpp>
+#include <ArbitrarySort.hpp>
+#include <ArbitraryTrace.hpp>
+#include <array>
+#include <atomic>
+#include <coroutine>
 #include <doctest/doctest.h>
+#include <future>
 #include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 // Type aliases for common sizes
 using Int128 = ArbitraryPrecision::FixedInteger<128>;
@@ -2195,3 +2219,1806 @@ TEST_SUITE("Dynamic Integer - Comparison with FixedInteger") {
     CHECK(ArbitraryPrecision::to_string(dyn).length() > 38);
   }
 }
+
+TEST_SUITE("Dynamic Integer - Constant Evaluation") {
+  constexpr Int256 dynamic_factorial(int n) {
+    Dynamic result(1);
+    for (int i = 2; i <= n; ++i) {
+      result *= Dynamic(i);
+    }
+    return Int256(result);
+  }
+
+  constexpr Int256 fixed_factorial(int n) {
+    Int256 result(1);
+    for (int i = 2; i <= n; ++i) {
+      result *= Int256(i);
+    }
+    return result;
+  }
+
+  // Powers of 10^19 computed with Dynamic and stored as Fixed
+  constexpr std::array<Int256, 4> radix_powers() {
+    std::array<Int256, 4> table{};
+    Dynamic power(1);
+    for (auto &entry : table) {
+      entry = Int256(power);
+      power *= Dynamic(10000000000000000000ULL);
+    }
+    return table;
+  }
+
+  TEST_CASE("Arithmetic in constant expressions") {
+    constexpr Int256 computed = dynamic_factorial(40);
+    static_assert(computed == fixed_factorial(40));
+    static_assert(Dynamic(100) / Dynamic(7) == Dynamic(14));
+    static_assert(Dynamic(100) % Dynamic(7) == Dynamic(2));
+    static_assert(((Dynamic(1) << 130) >> 129) == Dynamic(2));
+    static_assert(Dynamic(UINT64_MAX) + Dynamic(1) > Dynamic(UINT64_MAX));
+    CHECK(computed == fixed_factorial(40));
+  }
+
+  TEST_CASE("String conversion in constant expressions") {
+    static_assert(ArbitraryPrecision::to_string(Dynamic(1) << 100) ==
+                  "1267650600228229401496703205376");
+    static_assert(
+        ArbitraryPrecision::from_string<Dynamic>("18446744073709551616")
+            .value() == (Dynamic(1) << 64));
+    CHECK(ArbitraryPrecision::to_string(Dynamic(1) << 100) ==
+          "1267650600228229401496703205376");
+  }
+
+  TEST_CASE("Compile-time table emitted into FixedInteger array") {
+    constexpr auto table = radix_powers();
+    static_assert(table[0] == Int256(1));
+    static_assert(table[1] == Int256(10000000000000000000ULL));
+    CHECK(ArbitraryPrecision::to_string(table[3]) ==
+          "1000000000000000000000000000000000000000000000000000000000");
+  }
+}
+
+TEST_SUITE("Compile-time Tables") {
+  TEST_CASE("pow10 table") {
+    constexpr auto powers = ArbitraryPrecision::pow10_table<256, 78>();
+    static_assert(powers[0] == Int256(1));
+    static_assert(powers[19] == Int256(10000000000000000000ULL));
+    CHECK(ArbitraryPrecision::to_string(powers[77]) ==
+          "1" + std::string(77, '0'));
+  }
+
+  TEST_CASE("Limb pow10 table") {
+    static_assert(ArbitraryPrecision::limb_pow10[0] == 1);
+    static_assert(ArbitraryPrecision::limb_pow10[19] ==
+                  10000000000000000000ULL);
+  }
+
+  TEST_CASE("pow2 residues") {
+    constexpr Int256 modulus(1000000007);
+    constexpr auto residues =
+        ArbitraryPrecision::pow2_residue_table<256, 5>(modulus);
+    for (size_t i = 0; i < residues.size(); ++i) {
+      Dynamic expected = (Dynamic(1) << (64 * i)) % Dynamic(1000000007);
+      CHECK(Dynamic(residues[i]) == expected);
+    }
+  }
+
+  TEST_CASE("Small primes") {
+    constexpr auto primes = ArbitraryPrecision::small_primes<8>();
+    static_assert(primes ==
+                  std::array<uint64_t, 8>{3, 5, 7, 11, 13, 17, 19, 23});
+  }
+
+  TEST_CASE("Small prime inverses divide exactly") {
+    constexpr auto primes = ArbitraryPrecision::small_primes<16>();
+    constexpr auto inverses =
+        ArbitraryPrecision::small_prime_inverse_table<512, 16>();
+    const Int512 value = (Int512(1) << 400) + Int512(12345);
+    for (size_t i = 0; i < primes.size(); ++i) {
+      CHECK(inverses[i] * Int512(primes[i]) == Int512(1));
+      const Int512 multiple = value * Int512(primes[i]);
+      CHECK(multiple * inverses[i] == value);
+    }
+  }
+
+  TEST_CASE("Montgomery constants") {
+    // 2^255 - 19
+    constexpr Int256 p = (Int256(1) << 255) - Int256(19);
+    constexpr auto constants = ArbitraryPrecision::montgomery_constants(p);
+    static_assert(constants.r == Int256(38));
+    static_assert(constants.inverse * p.tail() == UINT64_MAX);
+
+    Dynamic r2 = (Dynamic(1) << 512) % Dynamic(p);
+    CHECK(Dynamic(constants.r2) == r2);
+    CHECK_THROWS_AS(ArbitraryPrecision::montgomery_constants(Int256(100)),
+                    std::domain_error);
+  }
+
+  TEST_CASE("Chunked conversion pads inner chunks") {
+    Dynamic value = Dynamic(10000000000000000000ULL) *
+                    Dynamic(10000000000000000000ULL);
+    CHECK(ArbitraryPrecision::to_string(value) == "1" + std::string(38, '0'));
+    CHECK(ArbitraryPrecision::from_string<Dynamic>("1" + std::string(38, '0'))
+              .value() == value);
+    CHECK(ArbitraryPrecision::from_string<Int128>("12345678901234567890x") ==
+          std::nullopt);
+  }
+}
+
+TEST_SUITE("Tracing") {
+  struct Recorded {
+    std::vector<std::string> begins;
+    std::vector<std::string> ends;
+  };
+
+  void record_begin(const ArbitraryPrecision::trace::Event &event,
+                    void *user) {
+    static_cast<Recorded *>(user)->begins.emplace_back(event.operation);
+  }
+
+  void record_end(const ArbitraryPrecision::trace::Event &event, void *user) {
+    static_cast<Recorded *>(user)->ends.emplace_back(event.operation);
+  }
+
+  TEST_CASE("Hooks receive begin and end for multiplication") {
+    Recorded recorded;
+    ArbitraryPrecision::trace::Hooks hooks{&record_begin, &record_end,
+                                           &recorded};
+    ArbitraryPrecision::trace::set_hooks(&hooks);
+    Dynamic product = Dynamic(12345) * Dynamic(67890);
+    ArbitraryPrecision::trace::set_hooks(nullptr);
+
+    CHECK(product == Dynamic(838102050));
+    CHECK(recorded.begins == std::vector<std::string>{"multiply"});
+    CHECK(recorded.ends == std::vector<std::string>{"multiply"});
+  }
+
+  TEST_CASE("Division and conversion are traced") {
+    Recorded recorded;
+    ArbitraryPrecision::trace::Hooks hooks{&record_begin, &record_end,
+                                           &recorded};
+    ArbitraryPrecision::trace::set_hooks(&hooks);
+    Dynamic q = Dynamic(100) / Dynamic(7);
+    std::string str = ArbitraryPrecision::to_string(q);
+    ArbitraryPrecision::trace::set_hooks(nullptr);
+
+    CHECK(str == "14");
+    CHECK(recorded.begins.front() == "divide");
+    CHECK(std::find(recorded.begins.begin(), recorded.begins.end(),
+                    "to_string") != recorded.begins.end());
+    CHECK(recorded.begins.size() == recorded.ends.size());
+  }
+
+  TEST_CASE("min_limbs filters small operations") {
+    Recorded recorded;
+    ArbitraryPrecision::trace::Hooks hooks{&record_begin, &record_end,
+                                           &recorded, 4};
+    ArbitraryPrecision::trace::set_hooks(&hooks);
+    Dynamic small = Dynamic(3) * Dynamic(5);
+    Dynamic large = (Dynamic(1) << 256) * Dynamic(5);
+    ArbitraryPrecision::trace::set_hooks(nullptr);
+
+    CHECK(small == Dynamic(15));
+    CHECK(large == (Dynamic(5) << 256));
+    CHECK(recorded.begins.size() == 1);
+  }
+
+  TEST_CASE("No callbacks once hooks are removed") {
+    Recorded recorded;
+    ArbitraryPrecision::trace::Hooks hooks{&record_begin, &record_end,
+                                           &recorded};
+    ArbitraryPrecision::trace::set_hooks(&hooks);
+    ArbitraryPrecision::trace::set_hooks(nullptr);
+    Dynamic product = Dynamic(6) * Dynamic(7);
+
+    CHECK(product == Dynamic(42));
+    CHECK(recorded.begins.empty());
+  }
+
+  TEST_CASE("Chrome trace writer emits paired events") {
+    ArbitraryPrecision::trace::ChromeTraceWriter writer;
+    ArbitraryPrecision::trace::set_hooks(&writer.hooks());
+    Dynamic product = (Dynamic(1) << 128) * Dynamic(3);
+    ArbitraryPrecision::trace::set_hooks(nullptr);
+
+    CHECK(product == (Dynamic(3) << 128));
+    CHECK(writer.size() == 2);
+
+    std::ostringstream out;
+    writer.write(out);
+    std::string json = out.str();
+    CHECK(json.starts_with("{\"traceEvents\":["));
+    CHECK(json.find("\"name\":\"multiply\"") != std::string::npos);
+    CHECK(json.find("\"ph\":\"B\"") != std::string::npos);
+    CHECK(json.find("\"ph\":\"E\"") != std::string::npos);
+    CHECK(json.find("\"algorithm\":\"schoolbook\"") != std::string::npos);
+  }
+}
+
+TEST_SUITE("Shared Integer") {
+  using ArbitraryPrecision::SharedInteger;
+
+  TEST_CASE("Copies share storage") {
+    SharedInteger a(Dynamic(1) << 1000);
+    SharedInteger b = a;
+
+    CHECK(a.shares_storage_with(b));
+    CHECK(a.use_count() == 2);
+    CHECK(a == b);
+  }
+
+  TEST_CASE("Mutation detaches") {
+    SharedInteger a(Dynamic(1) << 1000);
+    SharedInteger b = a;
+    b += SharedInteger(1);
+
+    CHECK_FALSE(a.shares_storage_with(b));
+    CHECK(a.use_count() == 1);
+    CHECK(a.value() == (Dynamic(1) << 1000));
+    CHECK(b.value() == (Dynamic(1) << 1000) + Dynamic(1));
+  }
+
+  TEST_CASE("Unique values mutate in place") {
+    SharedInteger a(42);
+    const Dynamic *before = &a.value();
+    a *= SharedInteger(2);
+
+    CHECK(&a.value() == before);
+    CHECK(a.value() == Dynamic(84));
+  }
+
+  TEST_CASE("Self-referencing compound assignment") {
+    SharedInteger a(21);
+    a += a;
+    CHECK(a.value() == Dynamic(42));
+
+    SharedInteger b = a;
+    b *= b;
+    CHECK(a.value() == Dynamic(42));
+    CHECK(b.value() == Dynamic(1764));
+  }
+
+  TEST_CASE("Arithmetic matches DynamicInteger") {
+    SharedInteger a(12345);
+    SharedInteger b(678);
+
+    CHECK((a + b).value() == Dynamic(13023));
+    CHECK((a - b).value() == Dynamic(11667));
+    CHECK((a * b).value() == Dynamic(8369910));
+    CHECK((a / b).value() == Dynamic(18));
+    CHECK((a % b).value() == Dynamic(141));
+    CHECK(((a << 70) >> 70) == a);
+    CHECK(a > b);
+    CHECK(ArbitraryPrecision::to_string(a) == "12345");
+  }
+
+  TEST_CASE("Copies are independent across threads") {
+    const SharedInteger original(Dynamic(1) << 512);
+    std::vector<std::thread> threads;
+    std::vector<SharedInteger> results(4);
+
+    for (size_t t = 0; t < results.size(); ++t) {
+      threads.emplace_back([&, t] {
+        for (int i = 0; i < 100; ++i) {
+          SharedInteger copy = original;
+          copy += SharedInteger(t);
+          results[t] = copy;
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    CHECK(original.value() == (Dynamic(1) << 512));
+    CHECK(original.use_count() == 1);
+    for (size_t t = 0; t < results.size(); ++t) {
+      CHECK(results[t].value() == (Dynamic(1) << 512) + Dynamic(t));
+    }
+  }
+
+  TEST_CASE("In-place mutation after other threads drop their copies") {
+    // Readers hold copies, read the limbs and drop them; the owner then
+    // sees a count of one and writes the same buffer in place. Run under
+    // TSan to check that the drops are ordered before the writes.
+    for (int round = 0; round < 50; ++round) {
+      SharedInteger value(Dynamic(round) << 256);
+      const auto *buffer = &value.value();
+      std::vector<std::thread> readers;
+      std::atomic<size_t> sum{0};
+      for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([copy = value, &sum] {
+          sum += (copy.value() >> 256).tail();
+        });
+      }
+      while (value.use_count() != 1) {
+        std::this_thread::yield();
+      }
+      value += SharedInteger(1);
+      CHECK(&value.value() == buffer);
+      CHECK(value.value() == (Dynamic(round) << 256) + Dynamic(1));
+      for (auto &reader : readers) {
+        reader.join();
+      }
+      CHECK(sum == size_t(3 * round));
+    }
+  }
+}
+
+TEST_SUITE("Integer Pool") {
+  using ArbitraryPrecision::IntegerPool;
+
+  TEST_CASE("Equal values are interned once") {
+    IntegerPool pool;
+    auto a = pool.intern(Dynamic(1) << 300);
+    auto b = pool.intern((Dynamic(1) << 300) + Dynamic(0));
+    auto c = pool.intern(Dynamic(7));
+
+    CHECK(pool.size() == 2);
+    CHECK(a == b);
+    CHECK(&a.value() == &b.value());
+    CHECK_FALSE(a == c);
+    CHECK(c < a);
+    CHECK(*c == Dynamic(7));
+  }
+
+  TEST_CASE("find returns existing handles only") {
+    IntegerPool pool;
+    auto a = pool.intern(Dynamic(12345));
+
+    CHECK(pool.find(Dynamic(12345)) == a);
+    CHECK_FALSE(pool.find(Dynamic(54321)).has_value());
+  }
+
+  TEST_CASE("Handles stay valid as the pool grows") {
+    IntegerPool pool;
+    auto first = pool.intern(Dynamic(0));
+    for (int i = 1; i < 1000; ++i) {
+      pool.intern(Dynamic(i));
+    }
+
+    CHECK(pool.size() == 1000);
+    CHECK(first.value() == Dynamic(0));
+    CHECK(pool.intern(Dynamic(0)) == first);
+  }
+
+  TEST_CASE("Concurrent interning deduplicates") {
+    IntegerPool pool;
+    std::vector<std::thread> threads;
+    std::vector<IntegerPool::Handle> handles;
+    std::mutex handles_mutex;
+
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&] {
+        auto handle = pool.intern(Dynamic(1) << 200);
+        std::lock_guard lock(handles_mutex);
+        handles.push_back(handle);
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    CHECK(pool.size() == 1);
+    for (const auto &handle : handles) {
+      CHECK(handle == handles.front());
+    }
+  }
+
+  TEST_CASE("std::hash agrees with equality") {
+    std::hash<Dynamic> hash_dynamic;
+    std::hash<Int256> hash_fixed;
+
+    CHECK(hash_dynamic(Dynamic(1) << 100) ==
+          hash_dynamic((Dynamic(1) << 101) >> 1));
+    CHECK(hash_dynamic(Dynamic(1)) != hash_dynamic(Dynamic(2)));
+    CHECK(hash_fixed(Int256(42)) == hash_fixed(Int256(6) * Int256(7)));
+  }
+}
+
+TEST_SUITE("Sorting") {
+  template <size_t Bits>
+  std::vector<ArbitraryPrecision::FixedInteger<Bits>>
+  random_keys(size_t count, size_t significant_limbs, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<ArbitraryPrecision::FixedInteger<Bits>> keys(count);
+    for (auto &key : keys) {
+      auto limbs = key.as_span();
+      for (size_t i = 0; i < significant_limbs; ++i) {
+        // Narrow values in the low limb make duplicates likely
+        limbs[i] = (i == 0) ? rng() % 1000 : rng();
+      }
+    }
+    return keys;
+  }
+
+  TEST_CASE("Radix sort matches std::sort") {
+    auto keys = random_keys<256>(5000, 4, 1);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ArbitraryPrecision::sort(std::span(keys));
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("Radix sort with mostly zero high limbs") {
+    auto keys = random_keys<128>(3000, 1, 2);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ArbitraryPrecision::sort(std::span(keys));
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("Small inputs") {
+    std::vector<Int128> keys{Int128(3), Int128(1), Int128(2)};
+    ArbitraryPrecision::sort(std::span(keys));
+    CHECK(keys == std::vector<Int128>{Int128(1), Int128(2), Int128(3)});
+
+    std::vector<Int128> empty;
+    ArbitraryPrecision::sort(std::span(empty));
+    CHECK(empty.empty());
+  }
+
+  TEST_CASE("Parallel radix sort matches std::sort") {
+    auto keys = random_keys<256>(20000, 3, 3);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ArbitraryPrecision::parallel_sort(std::span(keys), 4);
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("Parallel radix sort with uneven chunks") {
+    auto keys = random_keys<128>(1027, 2, 4);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    ArbitraryPrecision::parallel_sort(std::span(keys), 3);
+    CHECK(keys == expected);
+  }
+
+  TEST_CASE("Dynamic sort buckets by length") {
+    std::mt19937_64 rng(5);
+    std::vector<Dynamic> values;
+    for (int i = 0; i < 500; ++i) {
+      values.push_back(Dynamic(rng()) << (rng() % 300));
+    }
+    values.push_back(Dynamic(0));
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    // Values move between slots by swapping their limb buffers
+    std::vector<const uint64_t *> buffers;
+    for (const auto &value : values) {
+      buffers.push_back(value.as_span().data());
+    }
+
+    ArbitraryPrecision::sort(std::span(values));
+    CHECK(values == expected);
+    std::vector<const uint64_t *> sorted_buffers;
+    for (const auto &value : values) {
+      sorted_buffers.push_back(value.as_span().data());
+    }
+    std::ranges::sort(buffers);
+    std::ranges::sort(sorted_buffers);
+    CHECK(sorted_buffers == buffers);
+  }
+}
+
+TEST_SUITE("Residue Number System") {
+  using Rns4 = ArbitraryPrecision::RnsInteger<4>;
+
+  TEST_CASE("Moduli are distinct 32-bit primes") {
+    constexpr auto primes = ArbitraryPrecision::detail::rns_primes<8>();
+    static_assert(primes[0] == 4294967291ULL);
+    for (size_t i = 1; i < primes.size(); ++i) {
+      CHECK(primes[i] < primes[i - 1]);
+    }
+    CHECK(Rns4::modulus().length() == 2);
+  }
+
+  TEST_CASE("Round trip through residues") {
+    Dynamic value = (Dynamic(1) << 100) + Dynamic(12345);
+    CHECK(Rns4(value).to_integer() == value);
+    CHECK(Rns4(Dynamic(0)).to_integer() == Dynamic(0));
+    CHECK(Rns4(Rns4::modulus() - Dynamic(1)).to_integer() ==
+          Rns4::modulus() - Dynamic(1));
+  }
+
+  TEST_CASE("Channel-wise arithmetic matches modular arithmetic") {
+    const Dynamic &m = Rns4::modulus();
+    Dynamic a = (Dynamic(1) << 120) + Dynamic(999);
+    Dynamic b = (Dynamic(7) << 90) + Dynamic(31337);
+
+    CHECK((Rns4(a) + Rns4(b)).to_integer() == (a + b) % m);
+    CHECK((Rns4(a) - Rns4(b)).to_integer() == (a - b) % m);
+    CHECK((Rns4(a) * Rns4(b)).to_integer() == (a * b) % m);
+    CHECK((Rns4(b) - Rns4(a)).to_integer() == (m - (a - b) % m));
+  }
+
+  TEST_CASE("Values wider than M are reduced") {
+    Dynamic big = (Dynamic(1) << 400) + Dynamic(5);
+    CHECK(Rns4(big).to_integer() == big % Rns4::modulus());
+  }
+
+  TEST_CASE("RNS Montgomery multiplication") {
+    // Odd modulus well below the 8-prime base product
+    Dynamic n = (Dynamic(1) << 240) + Dynamic(297);
+    ArbitraryPrecision::RnsMontgomery<8> context(n);
+    Dynamic a = (Dynamic(1) << 239) + Dynamic(123456789);
+    Dynamic b = (Dynamic(3) << 200) + Dynamic(987654321);
+
+    auto am = context.to_montgomery(a);
+    auto bm = context.to_montgomery(b);
+    CHECK(context.from_montgomery(am) == a);
+    CHECK(context.from_montgomery(context.multiply(am, bm)) == (a * b) % n);
+
+    // Chained products stay correctly bounded
+    auto acc = context.to_montgomery(Dynamic(1));
+    Dynamic expected(1);
+    for (int i = 0; i < 20; ++i) {
+      acc = context.multiply(acc, am);
+      expected = expected * a % n;
+    }
+    CHECK(context.from_montgomery(acc) == expected);
+  }
+
+  TEST_CASE("RNS Montgomery with random operands near the size limit") {
+    using Context = ArbitraryPrecision::RnsMontgomery<4>;
+    const Dynamic bound = std::min(Context::main_base.product(),
+                                   Context::extension_base.product()) >>
+                          4;
+    const Dynamic n = bound - Dynamic(3);
+    Context context(n);
+
+    std::mt19937_64 rng(11);
+    for (int i = 0; i < 200; ++i) {
+      Dynamic a = ((Dynamic(rng()) << 64) | Dynamic(rng())) % n;
+      Dynamic b = ((Dynamic(rng()) << 64) | Dynamic(rng())) % n;
+      auto product = context.multiply(context.to_montgomery(a),
+                                      context.to_montgomery(b));
+      CHECK(context.from_montgomery(product) == (a * b) % n);
+    }
+  }
+
+  TEST_CASE("RNS Montgomery rejects unsupported moduli") {
+    using Context = ArbitraryPrecision::RnsMontgomery<2>;
+    CHECK_THROWS_AS(Context(Dynamic(1) << 70), std::domain_error);
+    CHECK_THROWS_AS(Context(Dynamic(4294967291ULL)), std::domain_error);
+  }
+}
+
+TEST_SUITE("CRT and Remainder Trees") {
+  using ArbitraryPrecision::crt;
+  using ArbitraryPrecision::multi_mod;
+
+  TEST_CASE("multi_mod matches per-modulus remainders") {
+    std::vector<uint64_t> moduli;
+    for (uint64_t m = 3; moduli.size() < 37; m += 2) {
+      moduli.push_back(m * 1000003ULL);
+    }
+    Dynamic value = (Dynamic(0x123456789ABCDEFULL) << 900) + Dynamic(77);
+    auto residues = multi_mod(value, moduli);
+    REQUIRE(residues.size() == moduli.size());
+    for (size_t i = 0; i < moduli.size(); ++i) {
+      CHECK(Dynamic(residues[i]) == value % Dynamic(moduli[i]));
+    }
+  }
+
+  TEST_CASE("crt inverts multi_mod for pairwise coprime moduli") {
+    // Large 64-bit primes exercise the full-width modular arithmetic
+    const std::vector<uint64_t> moduli = {
+        18446744073709551557ULL, 18446744073709551533ULL,
+        18446744073709551521ULL, 18446744073709551437ULL,
+        18446744073709551427ULL, 18446744073709551359ULL,
+        18446744073709551337ULL, 18446744073709551293ULL,
+        18446744073709551263ULL, 18446744073709551253ULL,
+        18446744073709551191ULL, 4294967291ULL,
+        65521ULL,                251ULL,
+        2ULL};
+    ArbitraryPrecision::SubproductTree tree(moduli);
+
+    std::mt19937_64 rng(85);
+    for (int i = 0; i < 20; ++i) {
+      Dynamic value;
+      for (int limb = 0; limb < 12; ++limb) {
+        value = (value << 64) | Dynamic(rng());
+      }
+      value %= tree.product();
+      auto residues = tree.reduce(value);
+      CHECK(tree.reconstruct(residues) == value);
+      CHECK(crt(residues, moduli) == value);
+    }
+  }
+
+  TEST_CASE("crt small example") {
+    const std::vector<uint64_t> moduli = {3, 5, 7};
+    const std::vector<uint64_t> residues = {2, 3, 2};
+    CHECK(crt(residues, moduli) == Dynamic(23));
+  }
+
+  TEST_CASE("crt rejects invalid input") {
+    const std::vector<uint64_t> shared = {6, 9};
+    const std::vector<uint64_t> residues = {1, 1};
+    CHECK_THROWS_AS(crt(residues, shared), std::domain_error);
+
+    const std::vector<uint64_t> moduli = {3, 5, 7};
+    CHECK_THROWS_AS(crt(residues, moduli), std::domain_error);
+  }
+}
+
+TEST_SUITE("Rational") {
+  using ArbitraryPrecision::Rational;
+
+  TEST_CASE("gcd and trailing_zeros") {
+    using ArbitraryPrecision::gcd;
+    CHECK(gcd(Dynamic(0), Dynamic(12)) == Dynamic(12));
+    CHECK(gcd(Dynamic(48), Dynamic(180)) == Dynamic(12));
+    CHECK(gcd(Int256(17), Int256(31)) == Int256(1));
+    Dynamic big = Dynamic(0xFFFFFFFFFFFFFFC5ULL) << 200;
+    CHECK(gcd(big * Dynamic(6), big * Dynamic(10)) == big * Dynamic(2));
+    CHECK(ArbitraryPrecision::trailing_zeros(Dynamic(1) << 130) == 130);
+  }
+
+  TEST_CASE("Arithmetic and formatting") {
+    Rational half(Dynamic(1), Dynamic(2));
+    Rational third(Dynamic(1), Dynamic(3));
+    CHECK(to_string(half + third) == "5/6");
+    CHECK(to_string(half - third) == "1/6");
+    CHECK(to_string(third - half) == "-1/6");
+    CHECK(to_string(half * third) == "1/6");
+    CHECK(to_string(half / third) == "3/2");
+    CHECK(to_string(Rational(-7) * Rational(Dynamic(3), Dynamic(14))) ==
+          "-3/2");
+    CHECK(to_string(Rational(Dynamic(6), Dynamic(4))) == "3/2");
+    CHECK(to_string(half + half) == "1");
+    CHECK(to_string(half - half) == "0");
+    CHECK((half / half) == Rational(1));
+    CHECK_THROWS_AS(half / Rational(0), std::domain_error);
+    CHECK_THROWS_AS(Rational(Dynamic(1), Dynamic(0)), std::domain_error);
+  }
+
+  TEST_CASE("Comparison ignores representation") {
+    Rational a(Dynamic(1), Dynamic(3));
+    Rational b = a * Rational(7) / Rational(7);
+    CHECK(a == b);
+    CHECK(Rational(Dynamic(2), Dynamic(3)) > a);
+    CHECK(Rational(-1) < Rational(Dynamic(1), Dynamic(1000)));
+    CHECK(-a < -Rational(Dynamic(1), Dynamic(4)));
+    CHECK(-Rational(0) == Rational(0));
+  }
+
+  TEST_CASE("Lazy reduction keeps sums exact and bounded") {
+    // Harmonic number H(60) accumulated without explicit normalization
+    Rational sum;
+    for (int k = 1; k <= 60; ++k) {
+      sum += Rational(Dynamic(1), Dynamic(k));
+    }
+    CHECK(sum.numerator().length() + sum.denominator().length() < 12);
+    CHECK(to_string(sum) ==
+          "15117092380124150817026911/3230237388259077233637600");
+    sum -= sum;
+    CHECK(!sum);
+
+    // Integer denominators stay one through integer-only paths
+    Rational integer(5);
+    integer *= Rational(-3);
+    integer += Rational(20);
+    CHECK(integer.is_integer());
+    CHECK(integer.truncate() == Dynamic(5));
+  }
+}
+
+TEST_SUITE("Fixed Decimal") {
+  using Money = ArbitraryPrecision::FixedDecimal<256, 18>;
+  using Cents = ArbitraryPrecision::FixedDecimal<128, 2>;
+  using ArbitraryPrecision::from_string;
+
+  TEST_CASE("Formatting and parsing") {
+    CHECK(to_string(Cents(12)) == "12.00");
+    CHECK(to_string(Cents(-3)) == "-3.00");
+    CHECK(to_string(Cents::from_raw(Int128(5))) == "0.05");
+    CHECK(to_string(*from_string<Cents>("-0.5")) == "-0.50");
+    const char *precise = "12345678901234567890.000000000000000001";
+    CHECK(to_string(*from_string<Money>(precise)) == precise);
+    CHECK_FALSE(from_string<Cents>("1.234").has_value());
+    CHECK_FALSE(from_string<Cents>(".5").has_value());
+    CHECK_FALSE(from_string<Cents>("1x").has_value());
+    // Raw values past 2^127 would wrap or set the sign bit
+    CHECK(to_string(*from_string<Cents>(
+              "-1701411834604692317316873037158841057.27")) ==
+          "-1701411834604692317316873037158841057.27");
+    CHECK_FALSE(from_string<Cents>("1701411834604692317316873037158841057.28")
+                    .has_value());
+    CHECK_FALSE(
+        from_string<Cents>("3402823669209384634633746074317682114.61")
+            .has_value());
+    CHECK_FALSE(from_string<Cents>(std::string(100, '9')).has_value());
+  }
+
+  TEST_CASE("Arithmetic rescales exactly") {
+    auto price = *from_string<Cents>("19.99");
+    CHECK(to_string(price * Cents(3)) == "59.97");
+    CHECK(to_string(price * *from_string<Cents>("-0.15")) == "-2.99");
+    CHECK(to_string(price / Cents(4)) == "4.99");
+    CHECK(to_string(price + Cents(-20)) == "-0.01");
+
+    auto rate = *from_string<Money>("1.000000000000000001");
+    auto large = *from_string<Money>("99999999999999999999.5");
+    CHECK(to_string(large * rate) ==
+          "100000000000000000099.499999999999999999");
+    CHECK(to_string(Money(1) / Money(3)) == "0.333333333333333333");
+    CHECK_THROWS_AS(Money(1) / Money(0), std::domain_error);
+  }
+
+  TEST_CASE("Reciprocal division matches long division") {
+    using Wide = ArbitraryPrecision::FixedInteger<512>;
+    std::mt19937_64 rng(87);
+    for (int i = 0; i < 100; ++i) {
+      Wide x;
+      for (auto &limb : x.as_span()) {
+        limb = rng();
+      }
+      CHECK(Money::divide_by_unit(x) ==
+            x / ArbitraryPrecision::detail::resize_fixed<512>(Money::unit));
+    }
+  }
+
+  TEST_CASE("Signed ordering and truncation") {
+    CHECK(Cents(-1) < Cents(0));
+    CHECK(Cents(-2) < Cents(-1));
+    CHECK(*from_string<Cents>("0.01") > Cents(0));
+    CHECK(to_string(from_string<Cents>("-7.99")->truncate()) == "-7.00");
+    static_assert(Cents(2) * Cents(3) == Cents(6));
+  }
+}
+
+TEST_SUITE("Big Float") {
+  using ArbitraryPrecision::BigFloat;
+  using ArbitraryPrecision::Rounding;
+
+  TEST_CASE("Newton division matches the definition") {
+    std::mt19937_64 rng(88);
+    for (int i = 0; i < 50; ++i) {
+      Dynamic a, b;
+      for (int limb = 0; limb < 40; ++limb) {
+        a = (a << 64) | Dynamic(rng());
+      }
+      for (int limb = 0; limb < 3 + i % 15; ++limb) {
+        b = (b << 64) | Dynamic(i % 2 ? rng() : ~uint64_t(0));
+      }
+      Dynamic q = a / b;
+      Dynamic r = a % b;
+      CHECK(q * b + r == a);
+      CHECK(r < b);
+    }
+  }
+
+  TEST_CASE("Rounding modes") {
+    const BigFloat one(1, 8);
+    const BigFloat three(3, 8);
+    // 1/3 = 0.0101010101... in binary
+    auto down = BigFloat::divide(one, three, 4, Rounding::toward_zero);
+    auto up = BigFloat::divide(one, three, 4, Rounding::up);
+    CHECK(down.mantissa() == Dynamic(5));
+    CHECK(down.exponent() == -4);
+    CHECK(up.mantissa() == Dynamic(11));
+    CHECK(up.exponent() == -5);
+    CHECK(BigFloat::divide(-one, three, 4, Rounding::down) == -up);
+    // Ties go to even: 9 * 2^0 at 3 bits is 8 or 10
+    CHECK(BigFloat(9, 3) == BigFloat(8));
+    CHECK(BigFloat(11, 3) == BigFloat(12));
+  }
+
+  TEST_CASE("Arithmetic and conversion") {
+    CHECK((BigFloat(1.5) + BigFloat(-0.25)).to_double() == 1.25);
+    CHECK((BigFloat(3) * BigFloat(-0.5)).to_double() == -1.5);
+    CHECK((BigFloat(1.0) / BigFloat(3.0)).to_double() == 1.0 / 3.0);
+    CHECK(!(BigFloat(7) - BigFloat(7)));
+    CHECK(BigFloat(-2) < BigFloat(0.5));
+    CHECK(BigFloat(1e300) > BigFloat(1e299));
+    // Far-apart operands still round correctly through the sticky bit
+    const BigFloat tiny(1e-300);
+    CHECK(BigFloat::add(BigFloat(1), tiny, 53, Rounding::up) >
+          BigFloat(1));
+    CHECK(BigFloat::add(BigFloat(1), tiny, 53) == BigFloat(1));
+    CHECK(to_string(BigFloat(-0.125), 3) == "-0.125");
+    CHECK(to_string(BigFloat(2.5), 0) == "3");
+    CHECK_THROWS_AS(BigFloat(1) / BigFloat(0), std::domain_error);
+  }
+
+  TEST_CASE("sqrt, exp and log") {
+    const size_t bits = 200;
+    CHECK(to_string(sqrt(BigFloat(2, bits)), 50) ==
+          "1.41421356237309504880168872420969807856967187537695");
+    CHECK(to_string(exp(BigFloat(1, bits)), 50) ==
+          "2.71828182845904523536028747135266249775724709369996");
+    CHECK(to_string(exp(BigFloat(-1, bits)), 50) ==
+          "0.36787944117144232159552377016146086744581113103177");
+    CHECK(to_string(log(BigFloat(2, bits)), 50) ==
+          "0.69314718055994530941723212145817656807550013436026");
+    CHECK(to_string(log(BigFloat(10, bits)), 50) ==
+          "2.30258509299404568401799145468436420760110148862877");
+    CHECK(sqrt(BigFloat(144)) == BigFloat(12));
+    CHECK(log(BigFloat(1)) == BigFloat(0));
+    CHECK(to_string(log(exp(BigFloat(123, 1000))), 40) ==
+          "123.0000000000000000000000000000000000000000");
+    CHECK_THROWS_AS(log(BigFloat(-1)), std::domain_error);
+    CHECK_THROWS_AS(sqrt(BigFloat(-1)), std::domain_error);
+  }
+
+  TEST_CASE("exp rejects arguments beyond the exponent range") {
+    using ArbitraryPrecision::DynamicInteger;
+    const BigFloat huge = BigFloat::from_parts(DynamicInteger(1), 1000000,
+                                               false, 64);
+    CHECK_THROWS_AS(exp(huge), std::domain_error);
+    CHECK_THROWS_AS(exp(-huge), std::domain_error);
+    CHECK_THROWS_AS(exp(BigFloat(std::ldexp(1.0, 62))), std::domain_error);
+    // Large arguments inside the range still work
+    const BigFloat large(std::ldexp(1.0, 20), 64);
+    CHECK(log(exp(large), 64) == large);
+    CHECK(exp(-large) > BigFloat(0));
+  }
+
+  TEST_CASE("log near one keeps full precision") {
+    using ArbitraryPrecision::DynamicInteger;
+    const DynamicInteger one = DynamicInteger(1) << 100;
+    const DynamicInteger step = DynamicInteger(1) << 101;
+    // log(1 - 2^-100) = -(2^-100 + 2^-201 + ...), and 1 + 2^-100 gives
+    // 2^-100 - 2^-201 + ...; the next terms fall below 128 bits
+    const BigFloat below =
+        BigFloat::from_parts(one - DynamicInteger(1), -100, false, 128);
+    CHECK(log(below, 128) ==
+          BigFloat::from_parts(step + DynamicInteger(1), -201, true, 128));
+    const BigFloat above =
+        BigFloat::from_parts(one + DynamicInteger(1), -100, false, 128);
+    CHECK(log(above, 128) ==
+          BigFloat::from_parts(step - DynamicInteger(1), -201, false, 128));
+    // Just under 2 and just over 1/2 reduce across the sqrt(2) boundary
+    CHECK(to_string(log(BigFloat(1.9999999999999998, 200)), 40) ==
+          "0.6931471805599451983949296589425163627365");
+    CHECK(to_string(log(BigFloat(0.75, 200)), 40) ==
+          "-0.2876820724517809274392190059938274315035");
+  }
+}
+
+TEST_SUITE("Constants") {
+  namespace constants = ArbitraryPrecision::constants;
+
+  TEST_CASE("pi, e and ln2 digits") {
+    CHECK(to_string(constants::pi(340), 100) ==
+          "3.14159265358979323846264338327950288419716939937510"
+          "58209749445923078164062862089986280348253421170680");
+    CHECK(to_string(constants::e(200), 50) ==
+          "2.71828182845904523536028747135266249775724709369996");
+    CHECK(to_string(constants::ln2(200), 50) ==
+          "0.69314718055994530941723212145817656807550013436026");
+    CHECK(constants::ln2(300) == log(ArbitraryPrecision::BigFloat(2, 300)));
+  }
+
+  TEST_CASE("Parallel splitting matches sequential") {
+    auto terms = [](size_t k) {
+      return ArbitraryPrecision::SeriesTerm{
+          Dynamic(k + 1), Dynamic(2 * k + 1), Dynamic(k + 3), Dynamic(k + 2),
+          k % 3 == 0};
+    };
+    auto sequential = ArbitraryPrecision::binary_split(terms, 0, 500);
+    // 2 and 3 threads leave merges with one or no spare thread
+    for (size_t threads : {2, 3, 4}) {
+      auto parallel =
+          ArbitraryPrecision::parallel_binary_split(terms, 0, 500, threads);
+      CHECK(parallel.t == sequential.t);
+      CHECK(parallel.t_negative == sequential.t_negative);
+      CHECK(parallel.q == sequential.q);
+      CHECK(parallel.b == sequential.b);
+    }
+    CHECK(constants::pi(2000, 4) == constants::pi(2000, 1));
+  }
+}
+
+TEST_SUITE("Polynomials") {
+  using ArbitraryPrecision::Polynomial;
+  using Field = ArbitraryPrecision::ModInt<128>;
+  // 2^127 - 1 is prime
+  const Int128 mersenne = (Int128(1) << 127) - Int128(1);
+
+  TEST_CASE("ModInt arithmetic") {
+    Field a(Int128(5), mersenne);
+    Field b(-3, mersenne);
+    CHECK(b.value() == mersenne - Int128(3));
+    CHECK(a + b == Field(2, mersenne));
+    CHECK(b - a == Field(-8, mersenne));
+    CHECK(a * b == Field(-15, mersenne));
+    CHECK(a / b * b == a);
+    CHECK(a.pow(Int128(127)) == a.pow(Int128(1)).pow(Int128(127)));
+    CHECK(Field(Int128(2), mersenne).pow(Int128(127)) == Field(1, mersenne));
+    CHECK_THROWS_AS(a + Field(1, Int128(7)), std::domain_error);
+    CHECK_THROWS_AS(Field(0, mersenne).inverse(), std::domain_error);
+  }
+
+  TEST_CASE("Kronecker multiplication matches the schoolbook product") {
+    std::mt19937_64 rng(90);
+    std::vector<Dynamic> a, b;
+    for (int i = 0; i < 25; ++i) {
+      a.push_back(Dynamic(rng()) << (i * 9));
+      b.push_back(i % 4 == 1 ? Dynamic(0) : Dynamic(rng()));
+    }
+    auto product = Polynomial<Dynamic>(a) * Polynomial<Dynamic>(b);
+    REQUIRE(product.size() == a.size() + b.size() - 1);
+    for (size_t k = 0; k < product.size(); ++k) {
+      Dynamic expected;
+      for (size_t i = 0; i < a.size(); ++i) {
+        if (k >= i && k - i < b.size()) {
+          expected += a[i] * b[k - i];
+        }
+      }
+      CHECK(product[k] == expected);
+    }
+    CHECK(product(Dynamic(3)) ==
+          Polynomial<Dynamic>(a)(Dynamic(3)) *
+              Polynomial<Dynamic>(b)(Dynamic(3)));
+  }
+
+  TEST_CASE("Field polynomials multiply and evaluate") {
+    // (x + 1)(x - 1) = x^2 - 1
+    Polynomial<Field> p({Field(1, mersenne), Field(1, mersenne)});
+    Polynomial<Field> q({Field(-1, mersenne), Field(1, mersenne)});
+    auto product = p * q;
+    CHECK(product == Polynomial<Field>({Field(-1, mersenne),
+                                        Field(0, mersenne),
+                                        Field(1, mersenne)}));
+    CHECK((product - product).size() == 0);
+    std::vector<Field> points = {Field(0, mersenne), Field(2, mersenne),
+                                 Field(-3, mersenne)};
+    auto values = product.evaluate(points);
+    CHECK(values[0] == Field(-1, mersenne));
+    CHECK(values[1] == Field(3, mersenne));
+    CHECK(values[2] == Field(8, mersenne));
+
+    Polynomial<Field> other({Field(1, Int128(7)), Field(1, Int128(7))});
+    CHECK_THROWS_AS(p * other, std::domain_error);
+  }
+
+  TEST_CASE("Multipoint evaluation with Newton remainders matches Horner") {
+    std::mt19937_64 rng(93);
+    // Enough points and coefficients that the remainder tree divides by
+    // series inversion; zero low coefficients exercise the reversals
+    std::vector<Field> coefficients(3, Field(0, mersenne));
+    for (int i = 0; i < 250; ++i) {
+      coefficients.emplace_back((Int128(rng()) << 64) | Int128(rng()),
+                                mersenne);
+    }
+    std::vector<Field> points;
+    for (int i = 0; i < 70; ++i) {
+      points.emplace_back((Int128(rng()) << 64) | Int128(rng()), mersenne);
+    }
+    const Polynomial<Field> polynomial(coefficients);
+    const auto values = polynomial.evaluate(points);
+    REQUIRE(values.size() == points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+      CHECK(values[i] == polynomial(points[i]));
+    }
+  }
+
+  TEST_CASE("Interpolation through the subproduct tree") {
+    std::mt19937_64 rng(91);
+    std::vector<Field> xs, ys;
+    for (int i = 0; i < 29; ++i) {
+      xs.emplace_back(i * i + 3, mersenne);
+      ys.emplace_back((Int128(rng()) << 64) | Int128(rng()), mersenne);
+    }
+    auto polynomial = Polynomial<Field>::interpolate(xs, ys);
+    CHECK(polynomial.size() <= xs.size());
+    CHECK(polynomial.evaluate(xs) == ys);
+    for (size_t i = 0; i < xs.size(); i += 7) {
+      CHECK(polynomial(xs[i]) == ys[i]);
+    }
+
+    std::vector<Field> repeated = {xs[0], xs[0]};
+    std::vector<Field> values = {ys[0], ys[1]};
+    CHECK_THROWS_AS(Polynomial<Field>::interpolate(repeated, values),
+                    std::domain_error);
+  }
+}
+
+TEST_SUITE("Matrix") {
+  using ArbitraryPrecision::Matrix;
+
+  template <typename T>
+  Matrix<T> naive_product(const Matrix<T> &a, const Matrix<T> &b) {
+    Matrix<T> result(a.rows(), b.cols());
+    for (size_t i = 0; i < a.rows(); ++i) {
+      for (size_t j = 0; j < b.cols(); ++j) {
+        for (size_t k = 0; k < a.cols(); ++k) {
+          result(i, j) += a(i, k) * b(k, j);
+        }
+      }
+    }
+    return result;
+  }
+
+  template <typename T>
+  Matrix<T> random_matrix(std::mt19937_64 &rng, size_t rows, size_t cols) {
+    Matrix<T> result(rows, cols);
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t j = 0; j < cols; ++j) {
+        result(i, j) = T(rng()) * T(rng()) + T(rng());
+      }
+    }
+    return result;
+  }
+
+  TEST_CASE("Dynamic add_product matches multiply and add") {
+    std::mt19937_64 rng(92);
+    for (int round = 0; round < 50; ++round) {
+      Dynamic a = Dynamic(rng()) << (rng() % 300);
+      Dynamic b = (Dynamic(rng()) << (rng() % 200)) + Dynamic(rng());
+      Dynamic acc = Dynamic(rng()) << (rng() % 400);
+      Dynamic expected = acc + a * b;
+      CHECK(acc.add_product(a, b) == expected);
+    }
+    Dynamic x(~uint64_t(0));
+    x.add_product(x, x);
+    CHECK(x == Dynamic(~uint64_t(0)) * Dynamic(~uint64_t(0)) +
+                   Dynamic(~uint64_t(0)));
+  }
+
+  TEST_CASE("Small products") {
+    Matrix<Dynamic> a(2, 3), b(3, 2);
+    for (size_t i = 0; i < 6; ++i) {
+      a(i / 3, i % 3) = Dynamic(i + 1);
+      b(i / 2, i % 2) = Dynamic(i + 7);
+    }
+    Matrix<Dynamic> product = a * b;
+    CHECK(product.rows() == 2);
+    CHECK(product.cols() == 2);
+    CHECK(product(0, 0) == Dynamic(58));
+    CHECK(product(0, 1) == Dynamic(64));
+    CHECK(product(1, 0) == Dynamic(139));
+    CHECK(product(1, 1) == Dynamic(154));
+    CHECK(Matrix<Dynamic>::identity(2) * product == product);
+    CHECK_THROWS_AS(a * a, std::domain_error);
+  }
+
+  TEST_CASE("Blocked, fused and parallel products agree") {
+    std::mt19937_64 rng(93);
+    auto a = random_matrix<Dynamic>(rng, 37, 45);
+    auto b = random_matrix<Dynamic>(rng, 45, 33);
+    auto expected = naive_product(a, b);
+    CHECK(ArbitraryPrecision::multiply(a, b, 1) == expected);
+    CHECK(ArbitraryPrecision::multiply(a, b, 4) == expected);
+
+    Matrix<Dynamic> c = random_matrix<Dynamic>(rng, 37, 33);
+    Matrix<Dynamic> accumulated = c + expected;
+    ArbitraryPrecision::addmul(c, a, b, 3);
+    CHECK(c == accumulated);
+  }
+
+  TEST_CASE("Strassen products of FixedInteger<256>") {
+    std::mt19937_64 rng(94);
+    for (size_t n : {64, 67, 130}) {
+      auto a = random_matrix<Int256>(rng, n, n);
+      auto b = random_matrix<Int256>(rng, n, n);
+      auto expected = naive_product(a, b);
+      CHECK(ArbitraryPrecision::multiply(a, b, 1) == expected);
+      CHECK(ArbitraryPrecision::multiply(a, b, 2) == expected);
+    }
+  }
+}
+
+TEST_SUITE("Elliptic Curves") {
+  using ArbitraryPrecision::Curve25519Field;
+  using ArbitraryPrecision::Ed25519;
+  using ArbitraryPrecision::FieldElement;
+  using ArbitraryPrecision::P256;
+  using ArbitraryPrecision::P256Field;
+  using ArbitraryPrecision::Secp256k1;
+  using ArbitraryPrecision::Secp256k1Field;
+  using ArbitraryPrecision::detail::hex256;
+  using ArbitraryPrecision::multi_scalar_multiply;
+  using ArbitraryPrecision::scalar_multiply;
+  using K1 = ArbitraryPrecision::JacobianPoint<Secp256k1>;
+  using R1 = ArbitraryPrecision::JacobianPoint<P256>;
+  using Ed = ArbitraryPrecision::ExtendedPoint<Ed25519>;
+
+  template <typename P>
+  void check_affine(const P &point, const Int256 &x, const Int256 &y) {
+    auto [px, py] = point.to_affine();
+    CHECK(px.value() == x);
+    CHECK(py.value() == y);
+  }
+
+  template <typename F> void check_reduction(std::mt19937_64 &rng) {
+    const Dynamic modulus(F::modulus);
+    std::vector<Int256> values = {F::modulus - Int256(1), Int256(0),
+                                  Int256(1)};
+    for (int i = 0; i < 200; ++i) {
+      Int256 value;
+      for (auto &limb : value.as_span()) {
+        limb = rng();
+      }
+      values.push_back(value % F::modulus);
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      const auto &a = values[i];
+      const auto &b = values[(i * 7 + 3) % values.size()];
+      auto product = FieldElement<F>(a) * FieldElement<F>(b);
+      CHECK(Dynamic(product.value()) == Dynamic(a) * Dynamic(b) % modulus);
+    }
+  }
+
+  TEST_CASE("Specialized field reductions") {
+    std::mt19937_64 rng(95);
+    check_reduction<Secp256k1Field>(rng);
+    check_reduction<P256Field>(rng);
+    check_reduction<Curve25519Field>(rng);
+
+    FieldElement<P256Field> x(12345);
+    CHECK(x * x.inverse() == FieldElement<P256Field>(1));
+    CHECK_THROWS_AS(FieldElement<P256Field>().inverse(), std::domain_error);
+  }
+
+  constexpr Int256 k = hex256(
+      "C0FFEE1234567890DEADBEEFCAFEBABE0123456789ABCDEF0FEDCBA987654321");
+
+  TEST_CASE("secp256k1 points") {
+    const K1 g = K1::generator();
+    check_affine(g.doubled(),
+                 hex256("C6047F9441ED7D6D3045406E95C07CD8"
+                        "5C778E4B8CEF3CA7ABAC09B95C709EE5"),
+                 hex256("1AE168FEA63DC339A3C58419466CEAEE"
+                        "F7F632653266D0E1236431A950CFE52A"));
+    check_affine(scalar_multiply(g, k),
+                 hex256("E27EBEE0E1F778B736B71140155395D7"
+                        "EC6610F834489458300319E7A1A644B5"),
+                 hex256("826F9612A01DFAAE3F86B90FE931E44F"
+                        "876D17E93CB6422F4D44ECCEC6846C32"));
+    CHECK(g + g == g.doubled());
+    CHECK(g.doubled() + g == scalar_multiply(g, Int256(3)));
+    CHECK((g + -g).is_identity());
+    CHECK(scalar_multiply(g, Secp256k1::order).is_identity());
+    CHECK(scalar_multiply(g, Secp256k1::order - Int256(1)) == -g);
+    CHECK(scalar_multiply(g, Int256(0)).is_identity());
+
+    auto [x, y] = g.to_affine();
+    CHECK(K1::from_affine(x, y) == g);
+    CHECK_THROWS_AS(K1::from_affine(x, x), std::domain_error);
+    CHECK_THROWS_AS(K1::identity().to_affine(), std::domain_error);
+  }
+
+  TEST_CASE("P-256 points") {
+    const R1 g = R1::generator();
+    check_affine(g.doubled(),
+                 hex256("7CF27B188D034F7E8A52380304B51AC3"
+                        "C08969E277F21B35A60B48FC47669978"),
+                 hex256("07775510DB8ED040293D9AC69F7430DB"
+                        "BA7DADE63CE982299E04B79D227873D1"));
+    check_affine(scalar_multiply(g, k),
+                 hex256("B3B86472BB2CBEC0D4C0D99C0F4D196E"
+                        "119AE88FF62805365656C8DB9136EE1F"),
+                 hex256("99C9544E83AF154C0E815743EA7B10C0"
+                        "33306C9308215F12E3ED0AA320673EC3"));
+    CHECK(scalar_multiply(g, P256::order).is_identity());
+    auto [x, y] = g.to_affine();
+    CHECK(R1::from_affine(x, y) == g);
+  }
+
+  TEST_CASE("Ed25519 points") {
+    const Ed b = Ed::generator();
+    check_affine(b.doubled(),
+                 hex256("36AB384C9F5A046C3D043B7D1833E7AC"
+                        "080D8E4515D7A45F83C5A14E2843CE0E"),
+                 hex256("2260CDF3092329C21DA25EE8C9A21F56"
+                        "97390F51643851560E5F46AE6AF8A3C9"));
+    check_affine(scalar_multiply(b, k),
+                 hex256("77B14D7A134A08C46B66F752052B9A28"
+                        "7C445BD9F4A73F9752D6795F1D32E9FD"),
+                 hex256("1004F75502119156CF2D5D811BAD77F1"
+                        "4A21B1C4CDAB9489EE312F87319C8134"));
+    CHECK(b + b == b.doubled());
+    CHECK((b + -b).is_identity());
+    CHECK(b + Ed::identity() == b);
+    CHECK(scalar_multiply(b, Ed25519::order).is_identity());
+  }
+
+  template <typename P> void check_msm(std::mt19937_64 &rng, size_t n) {
+    std::vector<P> points;
+    std::vector<Int256> scalars;
+    P expected;
+    for (size_t i = 0; i < n; ++i) {
+      Int256 scalar;
+      for (auto &limb : scalar.as_span()) {
+        limb = rng();
+      }
+      scalar >>= rng() % 256;
+      points.push_back(scalar_multiply(P::generator(), Int256(rng())));
+      scalars.push_back(scalar);
+      expected += scalar_multiply(points.back(), scalar);
+    }
+    CHECK(multi_scalar_multiply<P>(points, scalars) == expected);
+  }
+
+  TEST_CASE("Pippenger multi-scalar multiplication") {
+    std::mt19937_64 rng(96);
+    for (size_t n : {0, 1, 2, 7, 40}) {
+      check_msm<K1>(rng, n);
+      check_msm<R1>(rng, n);
+      check_msm<Ed>(rng, n);
+    }
+    std::vector<K1> points(2);
+    std::vector<Int256> scalars(3);
+    CHECK_THROWS_AS(multi_scalar_multiply<K1>(points, scalars),
+                    std::domain_error);
+  }
+}
+
+TEST_SUITE("Montgomery and CRT Exponentiation") {
+  using ArbitraryPrecision::CrtPowContext;
+  using ArbitraryPrecision::MontgomeryContext;
+  using ArbitraryPrecision::powmod;
+
+  // Square and multiply with DynamicInteger remainders
+  Dynamic reference_powmod(const Dynamic &base, const Dynamic &exponent,
+                           const Dynamic &modulus) {
+    Dynamic result = Dynamic(1) % modulus;
+    for (size_t bit = ArbitraryPrecision::bit_width(exponent); bit > 0;
+         --bit) {
+      result = result * result % modulus;
+      if (((exponent >> (bit - 1)) & Dynamic(1)) == Dynamic(1)) {
+        result = result * base % modulus;
+      }
+    }
+    return result;
+  }
+
+  template <size_t Bits>
+  ArbitraryPrecision::FixedInteger<Bits> random_value(std::mt19937_64 &rng) {
+    ArbitraryPrecision::FixedInteger<Bits> value;
+    for (auto &limb : value.as_span()) {
+      limb = rng();
+    }
+    return value;
+  }
+
+  TEST_CASE("Montgomery multiplication") {
+    std::mt19937_64 rng(97);
+    for (int round = 0; round < 20; ++round) {
+      Int512 modulus = random_value<512>(rng) >> (rng() % 400);
+      modulus.as_span()[0] |= 1;
+      const MontgomeryContext<512> context(modulus);
+      const Int512 a = random_value<512>(rng) % modulus;
+      const Int512 b = random_value<512>(rng);
+      const Int512 product = context.from_montgomery(
+          context.multiply(context.to_montgomery(a), context.to_montgomery(b)));
+      CHECK(Dynamic(product) == Dynamic(a) * Dynamic(b) % Dynamic(modulus));
+      CHECK(context.from_montgomery(context.one()) == Int512(1));
+    }
+    CHECK_THROWS_AS(MontgomeryContext<256>(Int256(10)), std::domain_error);
+  }
+
+  TEST_CASE("powmod against square and multiply") {
+    std::mt19937_64 rng(98);
+    for (int round = 0; round < 20; ++round) {
+      Int256 modulus = random_value<256>(rng) >> (rng() % 200);
+      if (round % 2) {
+        modulus.as_span()[0] |= 1;
+      }
+      modulus |= Int256(2);
+      const Int256 base = random_value<256>(rng);
+      const Int256 exponent = random_value<256>(rng) >> (rng() % 256);
+      CHECK(Dynamic(powmod(base, exponent, modulus)) ==
+            reference_powmod(Dynamic(base) % Dynamic(modulus),
+                             Dynamic(exponent), Dynamic(modulus)));
+    }
+    CHECK(powmod(Int256(3), Int256(0), Int256(7)) == Int256(1));
+    CHECK(powmod(Int256(3), Int256(5), Int256(1)) == Int256(0));
+    CHECK(powmod(Int256(2), Dynamic(10), Int256(1001)) == Int256(23));
+    CHECK_THROWS_AS(powmod(Int256(3), Int256(5), Int256(0)),
+                    std::domain_error);
+  }
+
+  TEST_CASE("CRT exponentiation with Garner recombination") {
+    using ArbitraryPrecision::from_string;
+    const Int256 p =
+        from_string<Int256>("89908337824550419007995043985641678516230495585"
+                            "925246170829438412049877665069")
+            .value();
+    const Int256 q =
+        from_string<Int256>("63441441967759435715762045242985474399674515791"
+                            "841898950793720184264905528351")
+            .value();
+    const Int512 d =
+        from_string<Int512>("78620263141699800945305905107444880098669584681"
+                            "28838141822826365567145096996462801678709360031"
+                            "79637398971484084610227938809931415412726571912"
+                            "532605053473")
+            .value();
+    const CrtPowContext<512> context(p, q, d);
+    const Int512 &n = context.modulus();
+    CHECK(Dynamic(n) == Dynamic(p) * Dynamic(q));
+
+    std::mt19937_64 rng(99);
+    for (int round = 0; round < 10; ++round) {
+      const Int512 message = random_value<512>(rng) % n;
+      const Int512 cipher = powmod(message, Int512(65537), n);
+      CHECK(context.pow(cipher, 1) == message);
+      CHECK(context.pow(cipher, 2) == message);
+      CHECK(context.pow(cipher) == powmod(cipher, d, n));
+    }
+    CHECK(context.pow(Int512(0)) == Int512(0));
+    CHECK(context.pow(Int512(1)) == Int512(1));
+    CHECK_THROWS_AS(CrtPowContext<512>(p, p, d), std::domain_error);
+    CHECK_THROWS_AS(CrtPowContext<512>(p, q * Int256(2), d), std::domain_error);
+  }
+}
+
+TEST_SUITE("Multi-Exponentiation") {
+  using ArbitraryPrecision::multi_powmod;
+  using ArbitraryPrecision::powmod;
+
+  Int256 product_of_powers(const std::vector<Int256> &bases,
+                           const std::vector<Int256> &exponents,
+                           const Int256 &modulus) {
+    Dynamic result = Dynamic(1) % Dynamic(modulus);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      result = result * Dynamic(powmod(bases[i], exponents[i], modulus)) %
+               Dynamic(modulus);
+    }
+    return Int256(result);
+  }
+
+  TEST_CASE("Straus and Pippenger match separate powmods") {
+    std::mt19937_64 rng(100);
+    for (size_t count : {0, 1, 2, 3, 9, 150}) {
+      for (bool odd : {true, false}) {
+        Int256 modulus((rng() | 2) & ~uint64_t(1));
+        modulus = (modulus << 192) | Int256(rng());
+        if (odd) {
+          modulus.as_span()[0] |= 1;
+        }
+        std::vector<Int256> bases, exponents;
+        for (size_t i = 0; i < count; ++i) {
+          bases.push_back((Int256(rng()) << 128) | Int256(rng()));
+          exponents.push_back((Int256(rng()) << 64 * (i % 4)) >> (i % 7));
+        }
+        CHECK(multi_powmod<256>(bases, exponents, modulus) ==
+              product_of_powers(bases, exponents, modulus));
+      }
+    }
+  }
+
+  TEST_CASE("Multi-exponentiation edge cases") {
+    const Int256 modulus(1000003);
+    std::vector<Int256> bases = {Int256(2), Int256(3)};
+    std::vector<Int256> exponents = {Int256(10), Int256(0)};
+    CHECK(multi_powmod<256>(bases, exponents, modulus) == Int256(1024));
+    exponents = {Int256(0), Int256(0)};
+    CHECK(multi_powmod<256>(bases, exponents, modulus) == Int256(1));
+    exponents.pop_back();
+    CHECK_THROWS_AS(multi_powmod<256>(bases, exponents, modulus),
+                    std::domain_error);
+  }
+}
+
+TEST_SUITE("Fixed-Base Exponentiation") {
+  using ArbitraryPrecision::FixedBasePow;
+  using ArbitraryPrecision::powmod;
+
+  TEST_CASE("Comb matches powmod across table shapes") {
+    std::mt19937_64 rng(101);
+    Int256 modulus = (Int256(rng()) << 192) | Int256(rng()) | Int256(1);
+    const Int256 base = (Int256(rng()) << 100) | Int256(rng());
+    // (teeth, tables): minimal, default, and one table per row bit
+    const std::array<std::pair<size_t, size_t>, 4> shapes = {
+        {{1, 1}, {4, 8}, {6, 43}, {16, 3}}};
+    for (auto [teeth, tables] : shapes) {
+      const FixedBasePow<256> comb(base, modulus, teeth, tables);
+      for (int round = 0; round < 10; ++round) {
+        Int256 exponent;
+        for (auto &limb : exponent.as_span()) {
+          limb = rng();
+        }
+        exponent >>= rng() % 256;
+        CHECK(comb.pow(exponent) == powmod(base, exponent, modulus));
+      }
+      CHECK(comb.pow(Int256(0)) == Int256(1));
+      CHECK(comb.pow(~Int256(0)) == powmod(base, ~Int256(0), modulus));
+    }
+  }
+
+  TEST_CASE("Comb exponent width") {
+    const Int256 modulus(1000003);
+    const FixedBasePow<256> comb(Int256(5), modulus, 3, 2, 40);
+    CHECK(comb.table_size() == 2 * 8);
+    CHECK(comb.pow(Dynamic(123456789)) ==
+          powmod(Int256(5), Int256(123456789), modulus));
+    CHECK(comb.pow(Int256(1) << 39) ==
+          powmod(Int256(5), Int256(1) << 39, modulus));
+    CHECK_THROWS_AS(comb.pow(Int256(1) << 40), std::domain_error);
+    CHECK_THROWS_AS(FixedBasePow<256>(Int256(5), modulus, 0),
+                    std::domain_error);
+    CHECK_THROWS_AS(FixedBasePow<256>(Int256(5), Int256(8)),
+                    std::domain_error);
+  }
+}
+
+TEST_SUITE("Modular Inverse and Jacobi Symbol") {
+  using ArbitraryPrecision::jacobi;
+  using ArbitraryPrecision::modinv;
+  using ArbitraryPrecision::modinv_constant_time;
+
+  TEST_CASE("Binary extended Euclid") {
+    std::mt19937_64 rng(102);
+    for (int round = 0; round < 200; ++round) {
+      Int256 m = Int256(rng()) << (rng() % 192);
+      m |= Int256(rng());
+      if (m <= Int256(1)) {
+        continue;
+      }
+      const Int256 a = (Int256(rng()) << 64) | Int256(rng());
+      if (ArbitraryPrecision::gcd(a, m) != Int256(1)) {
+        CHECK_THROWS_AS(modinv(a, m), std::domain_error);
+        continue;
+      }
+      const Int256 inverse = modinv(a, m);
+      CHECK(inverse < m);
+      CHECK(Dynamic(inverse) * Dynamic(a) % Dynamic(m) == Dynamic(1));
+      CHECK(modinv(Dynamic(a), Dynamic(m)) == Dynamic(inverse));
+    }
+    // Moduli with the top bit set must not overflow the cofactors
+    const Int256 top = ~Int256(0) - Int256(188);
+    const Int256 inverse = modinv(Int256(3), top);
+    CHECK(Dynamic(inverse) * Dynamic(3) % Dynamic(top) == Dynamic(1));
+    CHECK(modinv(Int256(5), Int256(1)) == Int256(0));
+    CHECK(modinv(Int256(3), Int256(8)) == Int256(3));
+    CHECK_THROWS_AS(modinv(Int256(0), Int256(7)), std::domain_error);
+    CHECK_THROWS_AS(modinv(Int256(4), Int256(8)), std::domain_error);
+  }
+
+  TEST_CASE("Constant-time safegcd inverse") {
+    std::mt19937_64 rng(103);
+    for (int round = 0; round < 100; ++round) {
+      Int256 m;
+      for (auto &limb : m.as_span()) {
+        limb = rng();
+      }
+      m >>= rng() % 200;
+      m |= Int256(1);
+      const Int256 a = Int256(rng()) % m;
+      if (!a || ArbitraryPrecision::gcd(a, m) != Int256(1)) {
+        CHECK_THROWS_AS(modinv_constant_time(a, m), std::domain_error);
+        continue;
+      }
+      CHECK(modinv_constant_time(a, m) == modinv(a, m));
+    }
+    const Int256 top = ~Int256(0) - Int256(188);
+    CHECK(modinv_constant_time(top - Int256(1), top) == top - Int256(1));
+    CHECK(modinv_constant_time(Int256(1), top) == Int256(1));
+    CHECK_THROWS_AS(modinv_constant_time(Int256(3), Int256(10)),
+                    std::domain_error);
+  }
+
+  TEST_CASE("Constant-time inverse with negative matrix entries") {
+    // Each divstep swap negates a row of the transition matrix; check that
+    // these inputs produce negative entries before comparing inverses
+    const Int256 m = ArbitraryPrecision::Secp256k1Field::modulus;
+    for (const Int256 &a : {m - Int256(2), m - Int256(12345), Int256(7),
+                            (m >> 1) | Int256(1)}) {
+      int64_t delta = 1;
+      const auto matrix =
+          ArbitraryPrecision::detail::divsteps_62(delta, m.tail(), a.tail());
+      bool negative = false;
+      for (const uint64_t entry : matrix) {
+        negative = negative || (entry >> 63);
+      }
+      CHECK(negative);
+      CHECK(modinv_constant_time(a, m) == modinv(a, m));
+    }
+    CHECK(modinv_constant_time(Int256(5), Int256(1)) == Int256(0));
+  }
+
+  TEST_CASE("Jacobi symbol") {
+    CHECK(jacobi(Int256(1001), Int256(9907)) == -1);
+    CHECK(jacobi(Int256(2), Int256(15)) == 1);
+    CHECK(jacobi(Int256(7), Int256(15)) == -1);
+    CHECK(jacobi(Int256(5), Int256(15)) == 0);
+    CHECK(jacobi(Int256(0), Int256(1)) == 1);
+    const Dynamic wide = Dynamic(19) << 300;
+    CHECK(jacobi(wide, Dynamic(45)) == jacobi(wide % Dynamic(45), Dynamic(45)));
+    CHECK(jacobi(wide, Dynamic(45)) != 0);
+    CHECK_THROWS_AS(jacobi(Int256(3), Int256(10)), std::domain_error);
+
+    // Euler's criterion for a prime: a^((p - 1) / 2) = (a / p)
+    const Int256 p = (Int256(1) << 127) - Int256(1);
+    std::mt19937_64 rng(104);
+    for (int round = 0; round < 50; ++round) {
+      const Int256 a = ((Int256(rng()) << 64) | Int256(rng())) % p;
+      const Int256 euler =
+          ArbitraryPrecision::powmod(a, (p - Int256(1)) >> 1, p);
+      const int expected = !a ? 0 : euler == Int256(1) ? 1 : -1;
+      CHECK(jacobi(a, p) == expected);
+      // Multiplicative in the modulus
+      CHECK(jacobi(a, Int256(9907) * Int256(15)) ==
+            jacobi(a, Int256(9907)) * jacobi(a, Int256(15)));
+    }
+  }
+}
+
+TEST_SUITE("Modular Square Root") {
+  using ArbitraryPrecision::sqrtmod;
+
+  void check_roots(const Int256 &p, std::mt19937_64 &rng) {
+    for (int round = 0; round < 30; ++round) {
+      const Int256 a = ((Int256(rng()) << 128) | Int256(rng())) % p;
+      const auto root = sqrtmod(a, p);
+      if (!root) {
+        CHECK(ArbitraryPrecision::jacobi(a, p) == -1);
+        continue;
+      }
+      CHECK(Dynamic(*root) * Dynamic(*root) % Dynamic(p) == Dynamic(a));
+
+      // Squares always have a root, and it is s or p - s
+      const Int256 s = (Int256(rng()) << 64 | Int256(rng())) % p;
+      const Int256 square = Int256(Dynamic(s) * Dynamic(s) % Dynamic(p));
+      const auto other = sqrtmod(square, p);
+      REQUIRE(other.has_value());
+      CHECK((*other == s || *other == (s ? p - s : s)));
+    }
+  }
+
+  TEST_CASE("Roots for each residue class of p") {
+    std::mt19937_64 rng(105);
+    // secp256k1 (3 mod 4), 2^255 - 19 (5 mod 8), P-224 (1 mod 2^96)
+    check_roots(ArbitraryPrecision::Secp256k1Field::modulus, rng);
+    check_roots(ArbitraryPrecision::Curve25519Field::modulus, rng);
+    check_roots((Int256(1) << 224) - (Int256(1) << 96) + Int256(1), rng);
+    // 998244353 = 119 * 2^23 + 1
+    check_roots(Int256(998244353), rng);
+    check_roots(Int256(17), rng);
+  }
+
+  TEST_CASE("Point decompression") {
+    using Point =
+        ArbitraryPrecision::JacobianPoint<ArbitraryPrecision::Secp256k1>;
+    const auto [x, y] = Point::generator().to_affine();
+    const auto p = ArbitraryPrecision::Secp256k1Field::modulus;
+    const auto rhs = x * x * x + Point::Field(7);
+    const auto root = sqrtmod(rhs.value(), p);
+    REQUIRE(root.has_value());
+    CHECK((*root == y.value() || *root == p - y.value()));
+  }
+
+  TEST_CASE("Square root edge cases") {
+    CHECK(sqrtmod(Int256(0), Int256(13)) == Int256(0));
+    CHECK(sqrtmod(Int256(13), Int256(13)) == Int256(0));
+    CHECK(sqrtmod(Int256(5), Int256(2)) == Int256(1));
+    CHECK(!sqrtmod(Int256(2), Int256(13)).has_value());
+    CHECK(sqrtmod(Int256(30), Int256(13)).has_value());
+    CHECK_THROWS_AS(sqrtmod(Int256(4), Int256(8)), std::domain_error);
+    // jacobi(4, 15) = 1, but 15 is not prime
+    CHECK_THROWS_AS(sqrtmod(Int256(4), Int256(15)), std::domain_error);
+  }
+}
+
+TEST_SUITE("Exact Division") {
+  using ArbitraryPrecision::divexact;
+  using ArbitraryPrecision::divexact_1;
+
+  TEST_CASE("Matches division for random exact quotients") {
+    std::mt19937_64 rng(98);
+    const auto random = [&rng](size_t limbs) {
+      std::vector<uint64_t> values(limbs);
+      for (auto &value : values) {
+        // Runs of zero and all-one limbs stress the borrow chain
+        const uint64_t pick = rng() % 4;
+        value = pick == 0 ? 0 : pick == 1 ? ~uint64_t(0) : rng();
+      }
+      return Dynamic(std::span<const uint64_t>(values));
+    };
+    for (int round = 0; round < 300; ++round) {
+      const Dynamic quotient = random(1 + rng() % 10);
+      Dynamic divisor = random(1 + rng() % 6);
+      if (!divisor) {
+        continue;
+      }
+      divisor <<= rng() % 100;
+      CHECK(divexact(quotient * divisor, divisor) == quotient);
+
+      const uint64_t limb = rng() >> (rng() % 64) | 1;
+      CHECK(divexact_1(quotient * Dynamic(limb), limb) == quotient);
+      CHECK(divexact_1(quotient << 7, uint64_t(128)) == quotient);
+    }
+  }
+
+  TEST_CASE("Fixed width") {
+    const Int256 a = Int256(0x123456789abcdefULL) << 100;
+    const Int256 b = (Int256(1) << 90) + Int256(3);
+    CHECK(divexact(a * b, b) == a);
+    CHECK(divexact(a * b, a) == b);
+    CHECK(divexact_1(a * Int256(12), 12) == a);
+    CHECK(divexact(Int256(0), b) == Int256(0));
+    CHECK(divexact(b, b) == Int256(1));
+    CHECK_THROWS_AS(divexact(a, Int256(0)), std::domain_error);
+    CHECK_THROWS_AS(divexact_1(a, 0), std::domain_error);
+  }
+
+  TEST_CASE("Rational normalization") {
+    const Dynamic factor = Dynamic(3) << 200;
+    ArbitraryPrecision::Rational value(Dynamic(7) * factor,
+                                       Dynamic(11) * factor);
+    value.normalize();
+    CHECK(value.numerator() == Dynamic(7));
+    CHECK(value.denominator() == Dynamic(11));
+  }
+}
+
+TEST_SUITE("Power-of-Two Division") {
+  using ArbitraryPrecision::div_pow2;
+  using ArbitraryPrecision::mod_pow2;
+
+  TEST_CASE("mod_pow2 and div_pow2") {
+    const Dynamic x = (Dynamic(0xdeadbeefULL) << 300) + (Dynamic(7) << 64) +
+                      Dynamic(0x1234ULL);
+    CHECK(mod_pow2(x, 0) == Dynamic(0));
+    CHECK(mod_pow2(x, 16) == Dynamic(0x1234ULL));
+    CHECK(mod_pow2(x, 64) == Dynamic(0x1234ULL));
+    CHECK(mod_pow2(x, 67) == (Dynamic(7) << 64) + Dynamic(0x1234ULL));
+    CHECK(mod_pow2(x, 1000) == x);
+    CHECK(div_pow2(x, 300) == Dynamic(0xdeadbeefULL));
+    CHECK(mod_pow2(Int256(-1), 255) == Int256(-1) >> 1);
+    CHECK(mod_pow2(Int256(-1), 256) == Int256(-1));
+    CHECK(div_pow2(Int256(1) << 200, 199) == Int256(2));
+  }
+
+  TEST_CASE("Operators detect single-bit divisors") {
+    std::mt19937_64 rng(99);
+    for (int round = 0; round < 200; ++round) {
+      std::vector<uint64_t> limbs(1 + rng() % 8);
+      for (auto &limb : limbs) {
+        limb = rng();
+      }
+      const Dynamic x{std::span<const uint64_t>(limbs)};
+      const size_t k = rng() % 600;
+      const Dynamic power = Dynamic(1) << k;
+      CHECK(x / power == x >> k);
+      CHECK(x % power == x - ((x >> k) << k));
+      CHECK(x / power * power + x % power == x);
+
+      // Two set bits take the general path
+      const Dynamic other = power + Dynamic(1);
+      CHECK(x / other * other + x % other == x);
+
+      const Int256 fixed = Int256(mod_pow2(x, 256));
+      const size_t shift = k % 256;
+      CHECK(fixed / (Int256(1) << shift) == fixed >> shift);
+      CHECK(fixed % (Int256(1) << shift) ==
+            fixed - ((fixed >> shift) << shift));
+    }
+  }
+}
+
+TEST_SUITE("Async Computations") {
+  using ArbitraryPrecision::OperationCancelled;
+
+  // Eagerly started coroutine that reports completion through a future
+  struct Task {
+    struct promise_type {
+      std::promise<void> done;
+      Task get_return_object() { return Task{done.get_future()}; }
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_never final_suspend() noexcept { return {}; }
+      void return_void() { done.set_value(); }
+      void unhandled_exception() {
+        done.set_exception(std::current_exception());
+      }
+    };
+    std::future<void> finished;
+  };
+
+  const Dynamic big = (Dynamic(1) << 4000) - Dynamic(12345);
+
+  TEST_CASE("Results match the synchronous operations") {
+    Dynamic product;
+    std::string digits;
+    Int256 power;
+    std::thread::id worker;
+    const auto body = [&]() -> Task {
+      product = co_await ArbitraryPrecision::co_multiply(big, big);
+      worker = std::this_thread::get_id();
+      digits = co_await ArbitraryPrecision::co_to_string(big);
+      power = co_await ArbitraryPrecision::co_powmod(
+          Int256(3), Int256(1000003), ArbitraryPrecision::P256Field::modulus);
+    };
+    body().finished.get();
+    CHECK(product == big * big);
+    CHECK(worker != std::this_thread::get_id());
+    CHECK(digits == ArbitraryPrecision::to_string(big));
+    CHECK(power == ArbitraryPrecision::powmod(
+                       Int256(3), Int256(1000003),
+                       ArbitraryPrecision::P256Field::modulus));
+  }
+
+  TEST_CASE("Custom executor") {
+    size_t tasks = 0;
+    const ArbitraryPrecision::Executor inline_executor =
+        [&tasks](std::function<void()> task) {
+          ++tasks;
+          task();
+        };
+    Dynamic product;
+    const auto body = [&]() -> Task {
+      product = co_await ArbitraryPrecision::co_multiply(
+          Dynamic(1) << 100, Dynamic(3), {}, inline_executor);
+    };
+    body().finished.get();
+    CHECK(tasks == 1);
+    CHECK(product == Dynamic(3) << 100);
+  }
+
+  TEST_CASE("Cancellation") {
+    std::stop_source stopped;
+    stopped.request_stop();
+    {
+      ArbitraryPrecision::StopScope scope(stopped.get_token());
+      CHECK_THROWS_AS(big * big, OperationCancelled);
+      CHECK_THROWS_AS((void)ArbitraryPrecision::to_string(big),
+                      OperationCancelled);
+    }
+    CHECK_NOTHROW(big * big);
+
+    const auto cancelled = [&]() -> Task {
+      co_await ArbitraryPrecision::co_to_string(big, stopped.get_token());
+    };
+    CHECK_THROWS_AS(cancelled().finished.get(), OperationCancelled);
+
+    // Stopped while running: seconds of schoolbook rows, with a
+    // cancellation point every few milliseconds
+    std::stop_source source;
+    const Dynamic huge = (Dynamic(1) << (64 * 40000)) - Dynamic(1);
+    const auto running = [&]() -> Task {
+      co_await ArbitraryPrecision::co_multiply(huge, huge,
+                                               source.get_token());
+    };
+    auto finished = running().finished;
+    source.request_stop();
+    CHECK_THROWS_AS(finished.get(), OperationCancelled);
+  }
+
+  TEST_CASE("Cancelled fused multiply-add leaves the accumulator valid") {
+    const Dynamic a = (Dynamic(1) << (64 * 200)) - Dynamic(3);
+    const Dynamic b = (Dynamic(1) << (64 * 100)) - Dynamic(5);
+    const Dynamic start = Dynamic(7) << 100;
+
+    std::stop_source stopped;
+    stopped.request_stop();
+    Dynamic accumulator = start;
+    {
+      ArbitraryPrecision::StopScope scope(stopped.get_token());
+      CHECK_THROWS_AS(accumulator.add_product(a, b), OperationCancelled);
+    }
+    CHECK(accumulator == start);
+    CHECK(accumulator.length() == start.length());
+
+    // Stop requested once the fused product has begun (from its trace
+    // event): it must either finish or leave the accumulator untouched
+    namespace trace = ArbitraryPrecision::trace;
+    std::stop_source source;
+    trace::Hooks hooks;
+    hooks.user = &source;
+    hooks.begin = [](const trace::Event &event, void *user) {
+      if (event.algorithm == "addmul") {
+        static_cast<std::stop_source *>(user)->request_stop();
+      }
+    };
+    Dynamic running = start;
+    trace::set_hooks(&hooks);
+    {
+      ArbitraryPrecision::StopScope scope(source.get_token());
+      CHECK_NOTHROW(running.add_product(a, b));
+    }
+    trace::set_hooks(nullptr);
+    CHECK(source.stop_requested());
+    CHECK(running == start + a * b);
+    CHECK(running.as_span().back() != 0);
+  }
+}